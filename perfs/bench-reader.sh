@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# Rebuild
+./build.sh
+
+# Concatenate the uf250 problems 60 times, about 90 MB
+input=$(mktemp --suffix=.cnf)
+trap "rm -f ${input}" EXIT
+for i in $(seq 60)
+do
+	cat data/uf250-1065/*.cnf
+done > ${input}
+
+# Bench
+build/perfs/benchCnfReader ${input}
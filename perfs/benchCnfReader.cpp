@@ -0,0 +1,165 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "CnfReader.h"
+#include "IntegerScanner.h"
+
+
+/**
+ * @brief What a reader found in a file.
+ * The checksum depends on the order of the integers, so that two readers
+ * only agree if they read the same integers in the same order.
+ */
+struct Reading {
+	unsigned long count = 0;
+	std::uint64_t checksum = 0xcbf29ce484222325;
+	long milliseconds = 0;
+
+	void add(int p_value) {
+		++count;
+		checksum = (checksum ^ static_cast<std::uint32_t>(p_value)) * 0x100000001b3;
+	}
+};
+
+
+/**
+ * Reads the integers of the clause lines with a string stream per line,
+ * as the loader used to.
+ */
+Reading readWithStringStreams(const char* p_filename) {
+	Reading reading;
+	std::ifstream file(p_filename);
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == 'c' || line[0] == 'p' || line[0] == '%')
+			continue;
+
+		std::istringstream tokens(line);
+		int value;
+		while (tokens >> value)
+			reading.add(value);
+	}
+	return reading;
+}
+
+
+/**
+ * Reads the integer tokens of a file with a CnfReader, skipping the other
+ * tokens and the comment and problem lines.
+ *
+ * @param p_bulk
+ *            whether the integers are read in bulk first, with the
+ *            IntegerScanner, or one by one only
+ */
+Reading readWithCnfReader(const char* p_filename, bool p_bulk) {
+	Reading reading;
+	sat::CnfReader reader(p_filename);
+	std::array<int, 4 * sat::IntegerScanner::BLOCK_VALUES> values;
+	while (true) {
+		if (p_bulk) {
+			auto count = reader.readIntegers(values.data(), values.size());
+			for (std::size_t i = 0; i < count; ++i)
+				reading.add(values[i]);
+			if (count > 0)
+				continue;
+		}
+
+		reader.skipWhitespace();
+		auto character = reader.peek();
+		if (character == sat::CnfReader::END)
+			break;
+
+		int value;
+		if (character == 'c' || character == 'p' || character == '%')
+			reader.skipLine();
+		else if (reader.readInteger(value))
+			reading.add(value);
+		else
+			reader.skipToken();
+	}
+	return reading;
+}
+
+
+/**
+ * Times a reader and prints what it found.
+ */
+template<class Reader>
+Reading measure(const char* p_name, Reader p_reader) {
+	auto start = std::chrono::steady_clock::now();
+	auto reading = p_reader();
+	reading.milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "  " << p_name << "\t" << reading.milliseconds << " ms\t" << reading.count << " integers, checksum " << std::hex << reading.checksum << std::dec << std::endl;
+	return reading;
+}
+
+
+/**
+ * Displays the usage message.
+ * 
+ * @param p_command
+ *            the command name as given to argv[0]
+ */
+void usage(char* p_command) {
+	std::cout << "Usage: " << p_command << " [-q] <cnf_file>" << std::endl;
+	std::cout << "    -q          only compare the readers of the CnfReader, without the string streams" << std::endl;
+	std::cout << "    <cnf_file>  a CNF problem" << std::endl;
+}
+
+
+/**
+ * Main function.
+ * Reads the integers of a CNF file with string streams, with the CnfReader
+ * one by one, then with the CnfReader in bulk, and prints the times.
+ * 
+ * @param p_argc
+ *            the count of arguments in p_argv
+ * @param p_argv
+ *            the array of command-line arguments
+ * 
+ * @return -1 if no file was given,
+ *          1 if the CnfReader read different integers one by one and in bulk,
+ *          0 otherwise
+ */
+int main(int p_argc, char* p_argv[]) {
+	auto quick = (p_argc == 3 && std::string(p_argv[1]) == "-q");
+	if (p_argc != 2 && !quick) {
+		usage(p_argv[0]);
+		exit(-1);
+	}
+	auto filename = p_argv[p_argc - 1];
+
+	std::cout << "Reading '" << filename << "' (" << sat::IntegerScanner::instructions() << "):" << std::endl;
+	if (!quick)
+		measure("istringstream", [&]() { return readWithStringStreams(filename); });
+	auto scalar = measure("readInteger", [&]() { return readWithCnfReader(filename, false); });
+	auto bulk = measure("readIntegers", [&]() { return readWithCnfReader(filename, true); });
+
+	if (scalar.count != bulk.count || scalar.checksum != bulk.checksum) {
+		std::cout << "The integers read in bulk differ from the ones read one by one." << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,178 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "CnfLoader.h"
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "History.h"
+#include "MostUsedVariableSelector.h"
+#include "IndexedMostUsedVariableSelector.h"
+#include "utils.h"
+
+
+/**
+ * Reduces the formula with a literal as the solver does: removes the
+ * clauses that contain it, then its opposite from the other clauses,
+ * then its variable. The changes are saved in the history.
+ *
+ * @return true if a clause became empty
+ */
+bool reduce(sat::Formula& p_formula, sat::Literal p_literal, sat::history::History& p_history) {
+	for (auto clause = p_literal.occurence(); notNull(clause); clause = p_literal.occurence()) {
+		p_history.addClause(clause);
+		p_formula.removeClause(clause);
+	}
+
+	auto conflict = false;
+	for (auto clause = p_literal.oppositeOccurence(); notNull(clause) && !conflict; clause = p_literal.oppositeOccurence()) {
+		p_history.addLiteral(clause, -p_literal);
+		p_formula.removeLiteralFromClause(clause, -p_literal);
+		conflict = clause->isUnsatisfiable();
+	}
+
+	p_formula.removeVariable(p_literal.var());
+	return conflict;
+}
+
+
+/**
+ * Tells whether both selectors pick the same variable, and prints them if not.
+ */
+bool compare(sat::Formula& p_formula, sat::solver::VariableSelector& p_expected, sat::solver::VariableSelector& p_actual, unsigned int p_step) {
+	auto expected = p_expected.getVariable(p_formula);
+	auto actual = p_actual.getVariable(p_formula);
+	if (expected == actual)
+		return true;
+
+	std::cout << "Step " << p_step << ": the indexed selector gives ";
+	if (isNull(actual))
+		std::cout << "no variable";
+	else
+		std::cout << "x" << actual->id() << " (" << actual->countOccurences() << " occurences)";
+	std::cout << " instead of ";
+	if (isNull(expected))
+		std::cout << "no variable." << std::endl;
+	else
+		std::cout << "x" << expected->id() << " (" << expected->countOccurences() << " occurences)." << std::endl;
+	return false;
+}
+
+
+/**
+ * Displays the usage message.
+ * 
+ * @param p_command
+ *            the command name as given to argv[0]
+ */
+void usage(char* p_command) {
+	std::cout << "Usage: " << p_command << " [-r <seed>] [-n <steps>] <cnf_file>" << std::endl;
+	std::cout << "    -r <seed>   the seed of the decisions, 1 by default" << std::endl;
+	std::cout << "    -n <steps>  the number of decisions and backtracks, 5000 by default" << std::endl;
+	std::cout << "    <cnf_file>  a CNF problem" << std::endl;
+}
+
+
+/**
+ * Main function.
+ * Walks the search tree of a formula with random decisions, reducing and
+ * restoring the formula as the solver does, and checks at each step that
+ * the IndexedMostUsedVariableSelector picks the same variable as the
+ * MostUsedVariableSelector.
+ * 
+ * @param p_argc
+ *            the count of arguments in p_argv
+ * @param p_argv
+ *            the array of command-line arguments
+ * 
+ * @return -1 if no file was given or it cannot be loaded,
+ *          1 if the selectors picked different variables,
+ *          0 otherwise
+ */
+int main(int p_argc, char* p_argv[]) {
+	unsigned int seed = 1;
+	unsigned int steps = 5000;
+	int option;
+	while ((option = getopt(p_argc, p_argv, "r:n:")) != -1) {
+		switch (option) {
+			case 'r':
+				seed = std::atoi(optarg);
+				break;
+
+			case 'n':
+				steps = std::atoi(optarg);
+				break;
+
+			default:
+				usage(p_argv[0]);
+				exit(-1);
+		}
+	}
+	if (optind != p_argc - 1) {
+		usage(p_argv[0]);
+		exit(-1);
+	}
+
+	sat::Formula formula;
+	sat::CnfLoader loader(1);
+	if (!loader.loadProblem(p_argv[optind], formula)) {
+		std::cout << "Could not load CNF file '" << p_argv[optind] << "'." << std::endl;
+		exit(-1);
+	}
+
+	sat::solver::selectors::MostUsedVariableSelector expected;
+	sat::solver::selectors::IndexedMostUsedVariableSelector actual(formula);
+	std::vector<std::unique_ptr<sat::history::History>> levels;
+	std::mt19937 random(seed);
+	auto conflict = false;
+
+	// Decide until a conflict or a satisfied formula, or at random, then backtrack
+	for (auto step = 0u; step < steps; ++step) {
+		if (!compare(formula, expected, actual, step))
+			return 1;
+
+		auto variable = expected.getVariable(formula);
+		if (conflict || isNull(variable) || (!levels.empty() && random() % 10 == 0)) {
+			if (levels.empty())
+				break;
+			levels.back()->replay(formula);
+			levels.pop_back();
+			conflict = false;
+			continue;
+		}
+
+		levels.emplace_back(std::make_unique<sat::history::History>());
+		conflict = reduce(formula, sat::Literal(variable, random() % 2 ? SIGN_POSITIVE : SIGN_NEGATIVE), *levels.back());
+	}
+
+	// Restore the whole formula
+	for (auto step = steps; !levels.empty(); ++step) {
+		levels.back()->replay(formula);
+		levels.pop_back();
+		if (!compare(formula, expected, actual, step))
+			return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+#!/bin/bash
+#
+# Solves small random CNF files with each preprocessing pass alone, and
+# checks that every pass gives the same status as the solver without
+# preprocessing, and a valid solution when the formula is satisfiable.
+# The files have many unit clauses, so that opposed units are frequent,
+# and a few fixed cases follow.
+#
+# Usage: perfs/fuzz-preprocessing.sh [<count>]
+
+count=${1:-200}
+solver=build/src/solveSat
+checker=build/src/checkSat
+if [ ! -x ${solver} ] || [ ! -x ${checker} ]
+then
+	./build.sh
+fi
+
+workdir=$(mktemp -d)
+trap "rm -rf ${workdir}" EXIT
+input=${workdir}/input.cnf
+output=${workdir}/output.sat
+
+# One strategy file per pass, and one without preprocessing
+passes="probing equivalence subsumption blocked elimination symmetry"
+for pass in none ${passes}
+do
+	rule="->"
+	for other in ${passes}
+	do
+		rule="${rule} ${other}=$([ ${other} = ${pass} ] && echo yes || echo no)"
+	done
+	echo "${rule}" > ${workdir}/${pass}.rules
+done
+
+failures=0
+checked=0
+
+# Solves the input with each pass and compares with the solver without preprocessing
+check() {
+	local name=$1
+	local expected=$(${solver} -n -s ${workdir}/none.rules ${input} | grep '^s ')
+	for pass in ${passes}
+	do
+		${solver} -n -s ${workdir}/${pass}.rules ${input} > ${output}
+		local status=$(grep '^s ' ${output})
+		if [ "${status}" != "${expected}" ]
+		then
+			echo "${name}, ${pass}: '${status}' instead of '${expected}'."
+			failures=$((failures + 1))
+		elif [ "${status}" = "s SATISFIABLE" ] && ! ${checker} ${input} ${output} > /dev/null
+		then
+			echo "${name}, ${pass}: invalid solution."
+			failures=$((failures + 1))
+		fi
+	done
+	checked=$((checked + 1))
+}
+
+for seed in $(seq ${count})
+do
+	awk -v seed=${seed} 'BEGIN {
+		srand(seed)
+		variables = 4 + int(rand() * 8)
+		clauses = 4 + int(rand() * 4 * variables)
+		printf "p cnf %d %d\n", variables, clauses
+		for (i = 0; i < clauses; i++) {
+			size = (rand() < 0.2 ? 1 : 2 + int(rand() * 3))
+			for (j = 0; j < size; j++)
+				printf "%s%d ", (rand() < 0.5 ? "-" : ""), 1 + int(rand() * variables)
+			printf "0\n"
+		}
+	}' > ${input}
+	check "Seed ${seed}"
+done
+
+# Opposed unit clauses followed by other unit clauses
+printf 'p cnf 4 5\n2 0\n3 0\n1 0\n-1 0\n1 4 0\n' > ${input}
+check "Opposed units before other units"
+printf 'p cnf 4 5\n1 0\n-1 0\n2 0\n3 0\n-2 4 0\n' > ${input}
+check "Opposed units first"
+
+echo "${checked} files solved, ${failures} failures."
+[ ${failures} -eq 0 ]
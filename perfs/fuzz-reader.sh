@@ -0,0 +1,62 @@
+#!/bin/bash
+#
+# Reads random CNF files with the CnfReader, one integer at a time and in
+# bulk, and checks that both read the same integers. The files mix valid
+# literals with invalid tokens, leading zeros, out-of-range values,
+# comments and line endings of all kinds, and a few fixed cases follow.
+#
+# Usage: perfs/fuzz-reader.sh [<count>]
+
+count=${1:-60}
+bench=build/perfs/benchCnfReader
+if [ ! -x ${bench} ]
+then
+	./build.sh
+fi
+
+input=$(mktemp --suffix=.cnf)
+trap "rm -f ${input}" EXIT
+
+failures=0
+for seed in $(seq ${count})
+do
+	awk -v seed=${seed} 'BEGIN {
+		srand(seed)
+		split("x 1x --3 - 5- 99999999999 12a3 -0", invalids, " ")
+		split(" | |\n|\t|  |\r\n| \n ", separators, "|")
+		printf "p cnf 3000 100000\n"
+		tokens = 2000 + int(rand() * 18000)
+		for (i = 0; i < tokens; i++) {
+			r = rand()
+			if (r < 0.6)       token = (rand() < 0.5 ? "-" : "") (1 + int(rand() * 3000))
+			else if (r < 0.75) token = "0"
+			else if (r < 0.78) token = sprintf("%0" (2 + int(rand() * 10)) "d", 1 + int(rand() * 3000))
+			else if (r < 0.79) token = invalids[1 + int(rand() * 8)]
+			else if (r < 0.80) token = "\nc comment 1 2 0\n"
+			else               token = 1 + int(rand() * 30)
+			printf "%s%s", token, separators[1 + int(rand() * 7)]
+		}
+	}' > ${input}
+
+	if ! ${bench} -q ${input} > /dev/null
+	then
+		echo "Seed ${seed}: the readers differ."
+		failures=$((failures + 1))
+	fi
+done
+
+# Tokens longer than a chunk: runs of leading zeros never overflow, and
+# must not be read past the end of the buffer
+for ending in '\n' '' ' 5 0\n'
+do
+	{ printf 'p cnf 1 1\n1 '; head -c $((3 << 20)) /dev/zero | tr '\0' '0'; printf "${ending}"; } > ${input}
+	if ! ${bench} -q ${input} > /dev/null
+	then
+		echo "Run of zeros ending with '${ending}': the readers differ."
+		failures=$((failures + 1))
+	fi
+	count=$((count + 1))
+done
+
+echo "${count} files read, ${failures} failures."
+[ ${failures} -eq 0 ]
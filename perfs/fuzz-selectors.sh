@@ -0,0 +1,32 @@
+#!/bin/bash
+#
+# Walks the search tree of the uf100 instances with random decisions and
+# backtracks, and checks that the indexed selector picks the same variable
+# as the most used variable selector at each step.
+#
+# Usage: perfs/fuzz-selectors.sh [<seeds>]
+
+seeds=${1:-3}
+checker=build/perfs/checkSelectors
+if [ ! -x ${checker} ]
+then
+	./build.sh
+fi
+
+count=0
+failures=0
+for file in data/uf100-430/*.cnf
+do
+	for seed in $(seq ${seeds})
+	do
+		if ! ${checker} -r ${seed} ${file} > /dev/null
+		then
+			echo "${file}, seed ${seed}: the selectors differ."
+			failures=$((failures + 1))
+		fi
+		count=$((count + 1))
+	done
+done
+
+echo "${count} walks, ${failures} failures."
+[ ${failures} -eq 0 ]
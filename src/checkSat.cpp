@@ -44,7 +44,8 @@ void usage(char* p_command) {
  * @param p_argv
  *            the array of command-line arguments
  * 
- * @return -2 if the log initialization fails,
+ * @return -3 if the CNF file cannot be loaded,
+ *         -2 if the log initialization fails,
  *         -1 if no argument was given,
  *          0 otherwise
  */
@@ -70,7 +71,10 @@ int main(int p_argc, char* p_argv[]) {
 		// Load the formula
 		sat::Formula formula;
 		sat::CnfLoader loader;
-		loader.loadProblem(cnfFilename, formula);
+		if (!loader.loadProblem(cnfFilename, formula)) {
+			std::cerr << "Could not load CNF file '" << cnfFilename << "', aborting." << std::endl;
+			exit(-3);
+		}
 		formula.log();
 
 		// Load the SAT solution file
@@ -0,0 +1,108 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef BATCH_QUEUE_H
+#define BATCH_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+namespace sat {
+
+/**
+ * @brief A bounded queue handing values from one thread to another.
+ *
+ * There must be a single producer and a single consumer. Each of them
+ * owns one of the two indexes and only reads the other, so no lock is
+ * taken: a thread only sleeps, on the index of the other thread, when
+ * the queue is full or empty.
+ *
+ * @tparam T
+ *            the type of the values, moved in and out of the queue
+ */
+template<class T>
+class BatchQueue {
+public:
+	/** The size of a cache line, the indexes are kept on separate lines. */
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	/**
+	 * Creates an empty queue.
+	 *
+	 * @param p_capacity
+	 *            the number of values the queue holds before the producer waits
+	 */
+	explicit BatchQueue(std::size_t p_capacity) :
+	m_slots(std::max<std::size_t>(p_capacity, 1)),
+	m_head(0),
+	m_tail(0) {
+	}
+
+	BatchQueue(const BatchQueue&) = delete;
+	BatchQueue& operator=(const BatchQueue&) = delete;
+
+	/**
+	 * Adds a value at the end of the queue, waiting while the queue is full.
+	 * Only called by the producer.
+	 *
+	 * @param p_value
+	 *            the value to add
+	 */
+	void push(T&& p_value) {
+		auto tail = m_tail.load(std::memory_order_relaxed);
+		for (auto head = m_head.load(std::memory_order_acquire); tail - head == m_slots.size(); head = m_head.load(std::memory_order_acquire))
+			m_head.wait(head, std::memory_order_acquire);
+
+		m_slots[tail % m_slots.size()] = std::move(p_value);
+		m_tail.store(tail + 1, std::memory_order_release);
+		m_tail.notify_one();
+	}
+
+	/**
+	 * Removes the value at the front of the queue, waiting while the queue
+	 * is empty. Only called by the consumer.
+	 *
+	 * @return the value removed
+	 */
+	T pop() {
+		auto head = m_head.load(std::memory_order_relaxed);
+		for (auto tail = m_tail.load(std::memory_order_acquire); tail == head; tail = m_tail.load(std::memory_order_acquire))
+			m_tail.wait(tail, std::memory_order_acquire);
+
+		T value = std::move(m_slots[head % m_slots.size()]);
+		m_head.store(head + 1, std::memory_order_release);
+		m_head.notify_one();
+		return value;
+	}
+
+private:
+	/** The values, in a ring. */
+	std::vector<T> m_slots;
+
+	/** The number of values removed, only written by the consumer. */
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head;
+
+	/** The number of values added, only written by the producer. */
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail;
+};
+
+} // namespace sat
+
+#endif // BATCH_QUEUE_H
@@ -38,6 +38,18 @@ FormulaObject(p_id) {
 
 
 // METHODS
+/**
+ * Sizes the clause for a number of literals, so that adding them
+ * allocates only once.
+ *
+ * @param p_literals
+ *            the expected number of literals
+ */
+void Clause::reserve(unsigned int p_literals) {
+	m_literals.reserve(p_literals);
+}
+
+
 /**
  * Adds a literal to the clause.
  *
@@ -85,6 +97,16 @@ bool Clause::isUnary() const {
 }
 
 
+/**
+ * Gives the number of literals of the clause.
+ *
+ * @return the count of literals
+ */
+unsigned int Clause::size() const {
+	return m_literals.size();
+}
+
+
 /**
  * Gives the first literal of the clause.
  *
@@ -41,6 +41,15 @@ public:
 	explicit Clause(Id p_id);
 
 
+	/**
+	 * Sizes the clause for a number of literals.
+	 *
+	 * @param p_literals
+	 *            the expected number of literals
+	 */
+	void reserve(unsigned int p_literals);
+
+
 	/**
 	 * Adds a literal to the clause.
 	 *
@@ -78,6 +87,14 @@ public:
 	bool isUnary() const;
 
 
+	/**
+	 * Gives the number of literals of the clause.
+	 *
+	 * @return the count of literals
+	 */
+	unsigned int size() const;
+
+
 	/**
 	 * Gives the first literal of the clause.
 	 *
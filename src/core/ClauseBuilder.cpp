@@ -32,7 +32,7 @@ namespace sat {
 ClauseBuilder::ClauseBuilder(Formula& p_formula) :
 m_formula(p_formula),
 m_clauseId(1),
-m_literals(nullptr) {}
+m_literals() {}
 
 
 /**
@@ -44,19 +44,20 @@ m_literals(nullptr) {}
 ClauseBuilder::ClauseBuilder(ClauseBuilder& p_builder) :
 m_formula(p_builder.m_formula),
 m_clauseId(p_builder.m_clauseId),
-m_literals(new std::vector<RawLiteral>(*p_builder.m_literals)) {}
+m_literals(p_builder.m_literals) {}
 
 
 // METHODS
 /**
  * Prepares this builder for a new clause.
+ * The buffer of the literals is cleared but keeps its capacity.
  *
  * @param p_clauseId
  *            the id of the new clause
  */
 ClauseBuilder& ClauseBuilder::reset(unsigned int p_clauseId) {
 	m_clauseId = p_clauseId;
-	m_literals = std::make_unique<std::vector<RawLiteral>>();
+	m_literals.clear();
 	return *this;
 }
 
@@ -65,7 +66,7 @@ ClauseBuilder& ClauseBuilder::reset(unsigned int p_clauseId) {
  * Adds a positive literal to the clause.
  */
 ClauseBuilder& ClauseBuilder::withPositiveLiteral(unsigned int p_variable) {
-	 m_literals->emplace_back(sat::RawLiteral(p_variable));
+	m_literals.emplace_back(p_variable);
 	return *this;
 }
 
@@ -73,7 +74,32 @@ ClauseBuilder& ClauseBuilder::withPositiveLiteral(unsigned int p_variable) {
  * Adds a negative literal to the clause.
  */
 ClauseBuilder& ClauseBuilder::withNegativeLiteral(unsigned int p_variable) {
-	 m_literals->emplace_back(-sat::RawLiteral(p_variable));
+	m_literals.emplace_back(-static_cast<int>(p_variable));
+	return *this;
+}
+
+
+/**
+ * Adds a literal to the clause.
+ *
+ * @param p_literal
+ *            the literal, signed as in the DIMACS format
+ */
+ClauseBuilder& ClauseBuilder::withLiteral(int p_literal) {
+	m_literals.emplace_back(p_literal);
+	return *this;
+}
+
+
+/**
+ * Adds literals to the clause.
+ *
+ * @param p_literals
+ *            the literals, signed as in the DIMACS format
+ */
+ClauseBuilder& ClauseBuilder::withLiterals(std::span<const int> p_literals) {
+	for (auto literal : p_literals)
+		m_literals.emplace_back(literal);
 	return *this;
 }
 
@@ -81,7 +107,7 @@ ClauseBuilder& ClauseBuilder::withNegativeLiteral(unsigned int p_variable) {
  * Builds the clause and add it to the formula.
  */
 Formula& ClauseBuilder::build() {
-	m_formula.createClause(m_clauseId, *(m_literals.get()));
+	m_formula.createClause(m_clauseId, m_literals);
 	return m_formula;
 }
 
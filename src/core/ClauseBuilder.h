@@ -17,7 +17,7 @@
 #ifndef CLAUSE_BUILDER_H
 #define CLAUSE_BUILDER_H
 
-#include <memory>
+#include <span>
 #include <vector>
 # include "RawLiteral.h"
 
@@ -28,6 +28,8 @@ class Formula;
 
 /**
  * A helper class following the Builder pattern.
+ * The literals are gathered in a buffer kept from one clause to the next,
+ * so that clauses created in bulk do not allocate anything but themselves.
  */
 class ClauseBuilder {
 public:
@@ -62,6 +64,22 @@ public:
 	 */
 	ClauseBuilder& withNegativeLiteral(unsigned int p_variable);
 
+	/**
+	 * Adds a literal to the clause.
+	 *
+	 * @param p_literal
+	 *            the literal, signed as in the DIMACS format
+	 */
+	ClauseBuilder& withLiteral(int p_literal);
+
+	/**
+	 * Adds literals to the clause.
+	 *
+	 * @param p_literals
+	 *            the literals, signed as in the DIMACS format
+	 */
+	ClauseBuilder& withLiterals(std::span<const int> p_literals);
+
 	/**
 	 * Builds the clause and adds it to the Formula.
 	 */
@@ -74,8 +92,8 @@ private:
 	/** The clause's id. */
 	Id m_clauseId;
 
-	/** The list of literals. */
-	std::unique_ptr<std::vector<sat::RawLiteral>> m_literals;
+	/** The literals of the current clause. */
+	std::vector<sat::RawLiteral> m_literals;
 };
 
 } // namespace sat
@@ -17,71 +17,286 @@
 #include "CnfLoader.h"
 
 #include <algorithm>
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include <string>
-#include <list>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <sys/stat.h>
+#include "BatchQueue.h"
+#include "Clause.h"
+#include "CnfReader.h"
+#include "Decompressor.h"
+#include "IntegerScanner.h"
+#include "Literal.h"
+#include "MappedFile.h"
 #include "utils.h"
 #include "log.h"
 
 
 namespace sat {
 
+namespace {
+
+/**
+ * Hashes the sorted literals of a clause.
+ */
+std::size_t hashClause(const std::vector<int>& p_literals) {
+	std::size_t hash = p_literals.size();
+	for (auto literal : p_literals)
+		hash ^= std::hash<int>()(literal) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+	return hash;
+}
+
+
+/**
+ * Tells whether a clause of the formula has the given literals.
+ *
+ * @param p_clause
+ *            the clause
+ * @param p_sorted
+ *            the sorted literals
+ * @param p_buffer
+ *            a buffer for the sorted literals of the clause
+ */
+bool hasLiterals(const Clause& p_clause, const std::vector<int>& p_sorted, std::vector<int>& p_buffer) {
+	if (p_clause.size() != p_sorted.size())
+		return false;
+
+	p_buffer.clear();
+	for (auto literal = p_clause.beginLiteral(); literal != p_clause.endLiteral(); ++literal)
+		p_buffer.push_back(literal->sign() * static_cast<int>(literal->id()));
+	std::sort(p_buffer.begin(), p_buffer.end());
+	return p_buffer == p_sorted;
+}
+
+
+/**
+ * Gives the most clauses or variables an input can declare honestly:
+ * each one takes at least two characters. The size of an input that is
+ * not a regular file is unknown, a batch is assumed then.
+ *
+ * @param p_filename
+ *            the name of the file, or "-" for the standard input
+ */
+std::size_t countLimit(const char* p_filename) {
+	struct stat status;
+	if (std::strcmp(p_filename, "-") != 0 && ::stat(p_filename, &status) == 0 && S_ISREG(status.st_mode))
+		return static_cast<std::size_t>(status.st_size) / 2;
+	return CnfLoader::BATCH_LITERALS;
+}
+
+
+/**
+ * Finds the first clause boundary after a position.
+ * The search starts at the next line, where no token or comment can be
+ * under way, and stops after the next '0' token or at a '%' line.
+ *
+ * @param p_position
+ *            the position to search from
+ * @param p_end
+ *            the end of the file
+ * @param p_origin
+ *            the start of the file
+ *
+ * @return the position where the next clause starts
+ */
+const char* findClauseBoundary(const char* p_position, const char* p_end, const char* p_origin) {
+	if (p_position == p_origin)
+		return p_position;
+	auto newline = static_cast<const char*>(std::memchr(p_position - 1, '\n', static_cast<std::size_t>(p_end - p_position + 1)));
+	if (isNull(newline))
+		return p_end;
+
+	CnfReader reader(newline + 1, p_end, p_origin);
+	while (true) {
+		reader.skipWhitespace();
+		auto character = reader.peek();
+		if (character == CnfReader::END || character == '%')
+			break;
+
+		if (character == 'c' || character == 'p') {
+			reader.skipLine();
+			continue;
+		}
+
+		int value;
+		if (!reader.readInteger(value))
+			reader.skipToken();
+		else if (value == 0)
+			break;
+	}
+	return newline + 1 + reader.offset();
+}
+
+} // anonymous namespace
+
+
+// CONSTRUCTORS
+/**
+ * Creates a loader that parses the big files on one thread per core.
+ */
+CnfLoader::CnfLoader() :
+CnfLoader(std::max(std::thread::hardware_concurrency(), 1u)) {
+}
+
+
+/**
+ * Creates a loader.
+ *
+ * @param p_threads
+ *            the number of threads parsing a big file
+ */
+CnfLoader::CnfLoader(unsigned int p_threads) :
+m_threads(std::max(p_threads, 1u)),
+m_stamp(0),
+m_tautology(false) {
+}
+
+
 // METHODS
 /**
  * Loads a SAT problem from a CNF file.
+ * The file is read as a stream of tokens: the comment and problem lines
+ * start with 'c' and 'p', a '%' line ends the problem as in the SATLIB
+ * files, and every other token is a literal, a '0' ending the current
+ * clause even when it spans several lines. The tautologies are skipped,
+ * and so are the clauses that have the same literals as a clause already
+ * loaded: each clause is sorted and hashed, and compared to the clauses
+ * already created with the same hash. A clause with an invalid token
+ * is skipped as a whole.
+ * A regular file of several parts is parsed concurrently, any other file,
+ * compressed ones included, is parsed in batches that are added to the
+ * formula as they are read, on another thread when several are allowed.
+ * The counts of the "p cnf" header size the formula before the first
+ * clause, within what the size of the file allows, and are checked once
+ * the file is read. The variables are linked
+ * to their clauses once all the clauses are created.
  * 
  * @param p_filename
- *            the name of the file to load
+ *            the name of the file to load, or "-" for the standard input
  * @param p_formula
  *            the formula to initialize
+ *
+ * @return false if the file could not be opened or read to its end,
+ *         true otherwise
  */
-void CnfLoader::loadProblem(char* p_filename, Formula& p_formula) {
+bool CnfLoader::loadProblem(char* p_filename, Formula& p_formula) {
 	log_debug(log_cnf, "Loading problem from CNF file '%s'...", p_filename);
 	
-	// Ouverture du fichier
-	std::ifstream file(p_filename);
-	if (!file.is_open()) {
-		log_error(log_cnf, "Could not open file '%s'.", p_filename);
-		return;
-	}
-	log_debug(log_cnf, "File '%s' opened.", p_filename);
-	
 	// Initializations
-	std::string line;
-	auto lineNo = 0;
 	auto clauseId = 1;
-	
-	while (getline(file, line)) {
-		lineNo++;
-		log_debug(log_cnf, "Line #%02d: |%s|", lineNo, line.c_str());
-		
-		// Ignore comment lines
-		if (line[0] == 'c')
-			continue;
-		
-		// Ignore project lines
-		if (line[0] == 'p')
-			continue;
-		
-		// Break at '%' lines
-		if (line[0] == '%')
-			break;
-		
-		// Transformation string -> tab
-		p_formula.createClause(clauseId, *parseClause(line));
-		++clauseId;
+	auto tautologies = 0;
+	auto duplicates = 0;
+	auto invalids = 0;
+	auto header = false;
+	auto declaredVariables = 0;
+	auto declaredClauses = 0;
+	Id maxVariableId = 0;
+	// The clauses created by the hash of their sorted literals
+	std::unordered_multimap<std::size_t, const Clause*> clauses;
+	std::vector<int> sorted;
+	std::vector<int> candidate;
+
+	// Adds the clauses of a batch to the formula, but for the duplicates
+	auto addBatch = [&](const ClauseBatch& p_batch) {
+		if (p_batch.header && !header) {
+			header = true;
+			declaredVariables = p_batch.declaredVariables;
+			declaredClauses = p_batch.declaredClauses;
+
+			// The counts are only hints, bounded by the size of the input
+			auto limit = countLimit(p_filename);
+			auto expectedClauses = std::min<std::size_t>(declaredClauses, limit);
+			p_formula.reserve(std::min<std::size_t>(declaredVariables, limit), expectedClauses);
+			clauses.reserve(expectedClauses);
+		}
+		tautologies += p_batch.tautologies;
+		invalids += p_batch.invalids;
+		maxVariableId = std::max(maxVariableId, p_batch.maxVariableId);
+
+		for (auto literal = p_batch.literals.begin(); literal != p_batch.literals.end(); ++literal) {
+			m_literals.clear();
+			for (; *literal != 0; ++literal)
+				m_literals.emplace_back(*literal);
+
+			sorted.assign(literal - m_literals.size(), literal);
+			std::sort(sorted.begin(), sorted.end());
+			auto hash = hashClause(sorted);
+			auto [first, last] = clauses.equal_range(hash);
+			if (std::any_of(first, last, [&](const auto& p_entry) { return hasLiterals(*p_entry.second, sorted, candidate); })) {
+				log_debug(log_cnf, "  - Duplicate clause skipped.");
+				++duplicates;
+				continue;
+			}
+
+			clauses.emplace(hash, p_formula.createClause(clauseId, m_literals).get());
+			++clauseId;
+		}
+	};
+
+	// Parse the big files concurrently
+	MappedFile file(p_filename, m_threads > 1 ? 2 * PARALLEL_PART_SIZE : std::numeric_limits<std::size_t>::max());
+	if (file.isOpen() && Decompressor::detect(file.begin(), file.size()) == Decompressor::Format::NONE) {
+		log_debug(log_cnf, "File '%s' mapped.", p_filename);
+		p_formula.deferOccurences();
+		parseConcurrently(file.begin(), file.end(), [&](const ClauseBatch& p_batch) {
+			addBatch(p_batch);
+			return !p_batch.last;
+		});
+	}
+	else {
+		// Open the file
+		CnfReader reader(p_filename);
+		if (!reader.isOpen()) {
+			log_error(log_cnf, "Could not open file '%s'.", p_filename);
+			return false;
+		}
+		log_debug(log_cnf, "File '%s' opened.", p_filename);
+		p_formula.deferOccurences();
+
+		if (m_threads > 1) {
+			parsePipelined(reader, addBatch);
+		}
+		else {
+			ClauseBatch batch;
+			while (parseClauses(reader, batch, BATCH_LITERALS))
+				addBatch(batch);
+			addBatch(batch);
+		}
+
+		if (reader.failed()) {
+			log_error(log_cnf, "Could not read file '%s' to its end.", p_filename);
+			return false;
+		}
+	}
+
+	decltype(clauses)().swap(clauses);
+	p_formula.linkOccurences();
+
+	// Check the problem line
+	auto readClauses = clauseId - 1 + tautologies + duplicates + invalids;
+	if (!header) {
+		log_warn(log_cnf, "No problem line in CNF file '%s'.", p_filename);
 	}
-	log_info(log_cnf, "Problem loaded from CNF file '%s'.", p_filename);
+	else if (readClauses != declaredClauses || maxVariableId > static_cast<Id>(declaredVariables)) {
+		log_warn(log_cnf, "The problem line of CNF file '%s' declares %d variables and %d clauses, but %u variables and %d clauses were read.", p_filename, declaredVariables, declaredClauses, maxVariableId, readClauses);
+	}
+	log_info(log_cnf, "Problem loaded from CNF file '%s', %d tautologies, %d duplicate and %d invalid clauses skipped.", p_filename, tautologies, duplicates, invalids);
+	return true;
 }
 
 
 /**
  * Loads a SAT solution from a SAT file.
+ * The literals are read from the 'v' lines up to the '0' token, so the
+ * solution may span several lines.
  * 
  * @param p_filename
- *            the name of the file to load
+ *            the name of the file to load, or "-" for the standard input
  * 
  * @return nullptr if p_filename is nullptr,
  *         the valuation loaded otherwise
@@ -90,8 +305,8 @@ std::unique_ptr<std::vector<RawLiteral>> CnfLoader::loadSolution(char* p_filenam
 	log_debug(log_cnf, "Loading solution from SAT file '%s'...", p_filename);
 	
 	// Ouverture du fichier
-	std::ifstream file(p_filename);
-	if (!file.is_open()) {
+	CnfReader reader(p_filename);
+	if (!reader.isOpen()) {
 		log_error(log_cnf, "Could not open file '%s'.", p_filename);
 		return nullptr;
 	}
@@ -99,27 +314,40 @@ std::unique_ptr<std::vector<RawLiteral>> CnfLoader::loadSolution(char* p_filenam
 	
 	// Initializations
 	auto solution = std::unique_ptr<std::vector<RawLiteral>>();
-	auto line = std::string();
-	auto lineNo = 0;
+	auto complete = false;
 	
-	while (getline(file, line)) {
-		lineNo++;
-		log_debug(log_cnf, "Line #%02d: |%s|", lineNo, line.c_str());
-		
-		// Ignore comment lines
-		if (line[0] == 'c')
-			continue;
+	while (!complete) {
+		reader.skipWhitespace();
+		auto character = reader.peek();
+		if (character == CnfReader::END)
+			break;
 		
-		// Ignore project lines
-		if (line[0] == 'p')
+		// Ignore the comment, problem and status lines
+		if (character != 'v') {
+			reader.skipLine();
 			continue;
+		}
 		
 		// Solution
-		if (line[0] == 'v') {
-			solution = parseClause(line.erase(0, 2)); // +2 to skip the two first characters: "v "
-			break;
+		reader.skip();
+		if (isNull(solution)) {
+			solution = std::make_unique<std::vector<RawLiteral>>();
+			beginClause();
+		}
+		for (reader.skipBlanks(); !complete && !CnfReader::isSeparator(reader.peek()); reader.skipBlanks()) {
+			int value;
+			if (!reader.readInteger(value)) {
+				log_warn(log_cnf, "  - Invalid token on line %lu, skipped.", reader.line());
+				reader.skipToken();
+			}
+			else if (value == 0)
+				complete = true;
+			else if (addLiteral(value))
+				solution->emplace_back(value);
 		}
 	}
+	if (notNull(solution) && m_tautology)
+		solution = nullptr;
 	log_info(log_cnf, "Solution loaded from SAT file '%s'.", p_filename);
 	
 	return solution;
@@ -127,69 +355,265 @@ std::unique_ptr<std::vector<RawLiteral>> CnfLoader::loadSolution(char* p_filenam
 
 
 /**
- * Parses a clause line from a cnf file.
- * 
+ * Parses clauses into a batch.
+ * The literals of a clause are appended to the batch as they are read, and
+ * removed when the clause turns out to be a tautology or to have an invalid
+ * token. A clause left without its '0' at the end of the input is kept.
+ *
+ * @param p_reader
+ *            the reader of the file
+ * @param p_batch
+ *            the batch to fill, cleared first
+ * @param p_maxLiterals
+ *            the number of literals after which the parsing stops at the
+ *            end of the current clause
+ *
+ * @return true if the parsing stopped before the end of the problem
  */
-std::unique_ptr<std::vector<RawLiteral>> CnfLoader::parseClause(std::string p_line) {
-	// I/ Création du tableau
-	auto literals = std::make_unique<std::vector<RawLiteral>>();
-	
-	// III/ Initialisation du tableau
-	std::istringstream source(p_line);
-	int token;
-	while ((source >> token) && (notNull(literals))) {
-		// If the '0' token is found, this is the end of the clause.
-		// NOTE this is not conformant to teh CNF format specification because some other
-		// clause might follow. But current test files do not use that feature.
-		if (token == 0)
+bool CnfLoader::parseClauses(CnfReader& p_reader, ClauseBatch& p_batch, std::size_t p_maxLiterals) {
+	p_batch.literals.clear();
+	p_batch.tautologies = 0;
+	p_batch.invalids = 0;
+	p_batch.header = false;
+	p_batch.maxVariableId = 0;
+	p_batch.last = false;
+
+	auto start = p_batch.literals.size();
+	auto pending = false;
+	auto invalid = false;
+
+	// Keeps the current clause, unless it must be skipped
+	auto endClause = [&]() {
+		if (invalid) {
+			++p_batch.invalids;
+			p_batch.literals.resize(start);
+		}
+		else if (m_tautology) {
+			++p_batch.tautologies;
+			p_batch.literals.resize(start);
+		}
+		else
+			p_batch.literals.push_back(0);
+		start = p_batch.literals.size();
+		beginClause();
+		pending = false;
+		invalid = false;
+	};
+
+	// Adds a literal read to the current clause, a 0 ends it
+	auto addValue = [&](int p_value) {
+		if (p_value == 0) {
+			endClause();
+			return;
+		}
+		if (addLiteral(p_value))
+			p_batch.literals.push_back(p_value);
+		p_batch.maxVariableId = std::max(p_batch.maxVariableId, static_cast<Id>(std::abs(p_value)));
+		pending = true;
+	};
+
+	std::array<int, 4 * IntegerScanner::BLOCK_VALUES> values;
+	beginClause();
+	while (true) {
+		// Stop the batch between two clauses
+		if (!pending && p_batch.literals.size() >= p_maxLiterals)
+			return true;
+
+		// Read the literals in bulk
+		auto count = p_reader.readIntegers(values.data(), values.size());
+		if (count > 0) {
+			std::for_each(values.begin(), values.begin() + count, addValue);
+			continue;
+		}
+
+		p_reader.skipWhitespace();
+		auto character = p_reader.peek();
+		if (character == CnfReader::END)
 			break;
+
+		// Ignore comment lines
+		if (character == 'c') {
+			p_reader.skipLine();
+			continue;
+		}
 		
-		// Parse current token
-		RawLiteral literal(token);
+		// Read the problem line
+		if (character == 'p') {
+			p_reader.skip();
+			p_reader.skipBlanks();
+			if (!p_batch.header && p_reader.readWord("cnf")) {
+				p_reader.skipBlanks();
+				if (p_reader.readInteger(p_batch.declaredVariables) && p_batch.declaredVariables >= 0) {
+					p_reader.skipBlanks();
+					if (p_reader.readInteger(p_batch.declaredClauses) && p_batch.declaredClauses >= 0) {
+						p_batch.header = true;
+						log_debug(log_cnf, "Problem line: %d variables, %d clauses.", p_batch.declaredVariables, p_batch.declaredClauses);
+					}
+				}
+			}
+			p_reader.skipLine();
+			continue;
+		}
 		
-		// On teste si l'entier n'apparaît pas déjà dans la variable
-		switch (existsLiteral(literal, *literals)) {
-			case 1: // Le token apparaît 2 fois avec le même "signe" -> pas ajouté cette fois
-				log_debug(log_cnf, "  - Literal %sx%u already parsed in that clause, skipped.", (literal.isNegative() ? "¬" : ""), literal.id());
-				break;
-				
-			case -1: // Le token et son contraire apparaîssent -> literals = nullptr
-				log_debug(log_cnf, "   - Literal %sx%u already parsed in that clause so it is always true.", (literal.isNegative() ? "¬" : ""), literal.id());
-				literals = nullptr;
-				break;
-				
-			default:
-				literals->emplace_back(literal);
-				log_debug(log_cnf, "  - Literal %sx%u parsed.", (literal.isNegative() ? "¬" : ""), literal.id());
+		// Break at '%' lines
+		if (character == '%') {
+			p_batch.last = true;
+			break;
+		}
+
+		// Read a literal
+		int value;
+		if (!p_reader.readInteger(value)) {
+			log_warn(log_cnf, "Invalid token on line %lu, clause skipped.", p_reader.line());
+			p_reader.skipToken();
+			pending = true;
+			invalid = true;
+			continue;
 		}
+		addValue(value);
 	}
-	
-	return literals;
+
+	// Keep a last clause without its '0'
+	if (pending) {
+		log_warn(log_cnf, "The clause on line %lu is not ended by a 0.", p_reader.line());
+		endClause();
+	}
+	return false;
 }
 
 
 /**
- * Searches a literal in a list of literals.
- * 
- * @param p_literal
- *            the literal to search
- * @param p_literals
- *            the list of literals
- * 
- * @return -1 if -p_literal appears in p_literals
- *          0 if p_literal does not appear in p_literals
- *          1 if p_literal appears in p_literals
+ * Parses a big file on several threads.
+ * The file is cut in as many parts as threads, at clause boundaries, and
+ * each part is parsed on its own thread. The batch of a part is given to
+ * the consumer as soon as it and the previous parts are parsed, while the
+ * next parts are still being parsed, and released afterwards.
+ *
+ * @param p_begin
+ *            the start of the file in memory
+ * @param p_end
+ *            the end of the file in memory
+ * @param p_consumer
+ *            called on the calling thread with the batch of each
+ *            consecutive part of the file, returns false to ignore
+ *            the next parts
  */
-int CnfLoader::existsLiteral(RawLiteral& p_literal, std::vector<RawLiteral>& p_literals) {
-	auto foundLiteral = find_if(p_literals.begin(), p_literals.end(), [p_literal](RawLiteral x){return x.id() == p_literal.id();});
-	
-	// Literal found
-	if (foundLiteral != p_literals.end()) {
-		return p_literal.sign() * (*foundLiteral).sign();
+void CnfLoader::parseConcurrently(const char* p_begin, const char* p_end, const std::function<bool(const ClauseBatch&)>& p_consumer) {
+	auto size = static_cast<std::size_t>(p_end - p_begin);
+	auto parts = std::max<std::size_t>(std::min<std::size_t>(m_threads, size / PARALLEL_PART_SIZE), 1);
+
+	// Cut the file at clause boundaries
+	std::vector<const char*> bounds { p_begin };
+	for (std::size_t part = 1; part < parts; ++part) {
+		auto bound = findClauseBoundary(std::max(bounds.back(), p_begin + part * (size / parts)), p_end, p_begin);
+		if (bound == p_end)
+			break;
+		bounds.push_back(bound);
+	}
+	bounds.push_back(p_end);
+	log_debug(log_cnf, "File cut in %zu parts.", bounds.size() - 1);
+
+	// Parse the parts
+	std::vector<ClauseBatch> batches(bounds.size() - 1);
+	std::vector<std::atomic<bool>> parsed(batches.size());
+	std::vector<std::jthread> workers;
+	for (std::size_t part = 0; part < batches.size(); ++part)
+		workers.emplace_back([&, part]() {
+			CnfLoader loader(1);
+			CnfReader reader(bounds[part], bounds[part + 1], p_begin);
+			loader.parseClauses(reader, batches[part], std::numeric_limits<std::size_t>::max());
+			parsed[part].store(true, std::memory_order_release);
+			parsed[part].notify_one();
+		});
+
+	// Hand the batches over in order
+	for (std::size_t part = 0; part < batches.size(); ++part) {
+		parsed[part].wait(false, std::memory_order_acquire);
+		if (!p_consumer(batches[part]))
+			break;
+		batches[part] = ClauseBatch();
+	}
+}
+
+
+/**
+ * Parses a file on another thread.
+ * The batches are handed to the calling thread through a bounded queue,
+ * so the parsing runs ahead of the consumer by a few batches at most.
+ *
+ * @param p_reader
+ *            the reader of the file
+ * @param p_consumer
+ *            called on the calling thread with each batch, in order
+ */
+void CnfLoader::parsePipelined(CnfReader& p_reader, const std::function<void(const ClauseBatch&)>& p_consumer) {
+	// An empty value ends the file
+	BatchQueue<std::optional<ClauseBatch>> queue(QUEUE_BATCHES);
+	std::jthread parser([&]() {
+		CnfLoader loader(1);
+		auto more = true;
+		while (more) {
+			ClauseBatch batch;
+			more = loader.parseClauses(p_reader, batch, BATCH_LITERALS);
+			queue.push(std::move(batch));
+		}
+		queue.push(std::nullopt);
+	});
+
+	while (auto batch = queue.pop())
+		p_consumer(*batch);
+}
+
+
+/**
+ * Starts a new clause.
+ * The stamps of the previous clause are left as they are, they are only
+ * reset when the stamp wraps around.
+ */
+void CnfLoader::beginClause() {
+	m_tautology = false;
+
+	// Nouveau tampon, les anciens sont effacés avant de reboucler
+	if (m_stamp == std::numeric_limits<int>::max()) {
+		std::fill(m_stamps.begin(), m_stamps.end(), 0);
+		m_stamp = 0;
 	}
+	++m_stamp;
+}
+
 
-	// Not found
-	return 0;
+/**
+ * Tells whether a literal is not in the current clause yet.
+ * The literals already in the clause are found with the stamps of their
+ * variable, in constant time. A literal whose negation is in the clause
+ * makes it a tautology.
+ *
+ * @param p_value
+ *            the literal read, a non-null integer
+ *
+ * @return true if the literal must be added to the clause
+ */
+bool CnfLoader::addLiteral(int p_value) {
+	RawLiteral literal(p_value);
+	if (literal.id() >= m_stamps.size())
+		m_stamps.resize(literal.id() + 1, 0);
+	auto& stamp = m_stamps[literal.id()];
+	
+	// On teste si l'entier n'apparaît pas déjà dans la variable
+	if (stamp == literal.sign() * m_stamp) {
+		// Le token apparaît 2 fois avec le même "signe" -> pas ajouté cette fois
+		log_debug(log_cnf, "  - Literal %sx%u already parsed in that clause, skipped.", (literal.isNegative() ? "¬" : ""), literal.id());
+		return false;
+	}
+	if (stamp == -literal.sign() * m_stamp) {
+		// Le token et son contraire apparaîssent -> tautologie
+		log_debug(log_cnf, "   - Literal %sx%u already parsed in that clause so it is always true.", (literal.isNegative() ? "¬" : ""), literal.id());
+		m_tautology = true;
+		return false;
+	}
+	stamp = literal.sign() * m_stamp;
+	log_debug(log_cnf, "  - Literal %sx%u parsed.", (literal.isNegative() ? "¬" : ""), literal.id());
+	return true;
 }
 
 } // namespace sat
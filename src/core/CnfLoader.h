@@ -17,6 +17,8 @@
 #ifndef CNF_LOADER_H
 #define CNF_LOADER_H
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <vector>
 #include "Formula.h"
@@ -24,17 +26,62 @@
 
 namespace sat {
 
+class CnfReader;
+
+
+/**
+ * @brief Loads problems and solutions in the DIMACS CNF format.
+ * The duplicate literals of a clause are dropped, and so are the
+ * tautologies and the duplicate clauses of a problem.
+ *
+ * The files are read as a stream of tokens, in chunks of a bounded size,
+ * so they can also be piped on the standard input: a clause is ended by
+ * its '0' token, wherever the line breaks are. The clauses are parsed in
+ * batches, then given to the formula. When several threads are allowed,
+ * a thread parses the batches and hands them through a queue to the
+ * thread building the formula, so both run at the same time.
+ *
+ * A big file is mapped in memory and cut in parts at clause boundaries,
+ * which are parsed concurrently. The batches are added to the formula in
+ * the order of the file as soon as they are parsed, so the clauses get the
+ * same ids as when the file is read in sequence.
+ */
 class CnfLoader {
 public:
+	/** A file is cut in parts of at least that size to be parsed concurrently. */
+	static constexpr std::size_t PARALLEL_PART_SIZE = 4 << 20;
+
+	/** The number of literals parsed before a batch is added to the formula. */
+	static constexpr std::size_t BATCH_LITERALS = 1 << 20;
+
+	/** The number of batches parsed ahead of the formula. */
+	static constexpr std::size_t QUEUE_BATCHES = 4;
+
+	/**
+	 * Creates a loader that parses the big files on one thread per core.
+	 */
+	CnfLoader();
+
+	/**
+	 * Creates a loader.
+	 *
+	 * @param p_threads
+	 *            the number of threads parsing a big file
+	 */
+	explicit CnfLoader(unsigned int p_threads);
+
 	/**
 	* Loads a SAT problem from a CNF file.
 	* 
 	* @param p_filename
-	*            the name of the file to load
+	*            the name of the file to load, or "-" for the standard input
 	* @param p_formula
 	*            the formula to initialize
+	*
+	* @return false if the file could not be opened or read to its end,
+	*         true otherwise
 	*/
-	void loadProblem(char* p_filename, Formula& p_formula);
+	bool loadProblem(char* p_filename, Formula& p_formula);
 
 
 	/**
@@ -51,29 +98,108 @@ public:
 
 protected:
 	/**
-	 * Parses a clause line from a cnf file as a list of raw literals.
-	 * 
-	 * @param p_line
-	 *            the line to parse
-	 * 
-	 * @return the list of raw literals
+	 * @brief The clauses parsed from a part of a file, before they are
+	 * added to a formula.
+	 */
+	struct ClauseBatch {
+		/** The literals of the clauses kept, each clause ended by a 0. */
+		std::vector<int> literals;
+
+		/** The number of tautologies skipped. */
+		int tautologies = 0;
+
+		/** The number of clauses with an invalid token skipped. */
+		int invalids = 0;
+
+		/** Whether a problem line was read. */
+		bool header = false;
+
+		/** The number of variables declared by the problem line. */
+		int declaredVariables = 0;
+
+		/** The number of clauses declared by the problem line. */
+		int declaredClauses = 0;
+
+		/** The biggest variable id read. */
+		Id maxVariableId = 0;
+
+		/** Whether a '%' line ended the problem. */
+		bool last = false;
+	};
+
+	/**
+	 * Parses clauses into a batch.
+	 *
+	 * @param p_reader
+	 *            the reader of the file
+	 * @param p_batch
+	 *            the batch to fill, cleared first
+	 * @param p_maxLiterals
+	 *            the number of literals after which the parsing stops at
+	 *            the end of the current clause
+	 *
+	 * @return true if the parsing stopped before the end of the problem
+	 */
+	bool parseClauses(CnfReader& p_reader, ClauseBatch& p_batch, std::size_t p_maxLiterals);
+
+	/**
+	 * Parses a big file on several threads.
+	 *
+	 * @param p_begin
+	 *            the start of the file in memory
+	 * @param p_end
+	 *            the end of the file in memory
+	 * @param p_consumer
+	 *            called on the calling thread with the batch of each
+	 *            consecutive part of the file, returns false to ignore
+	 *            the next parts
+	 */
+	void parseConcurrently(const char* p_begin, const char* p_end, const std::function<bool(const ClauseBatch&)>& p_consumer);
+
+	/**
+	 * Parses a file on another thread.
+	 *
+	 * @param p_reader
+	 *            the reader of the file
+	 * @param p_consumer
+	 *            called on the calling thread with each batch, in order
+	 */
+	void parsePipelined(CnfReader& p_reader, const std::function<void(const ClauseBatch&)>& p_consumer);
+
+	/**
+	 * Starts a new clause.
+	 */
+	void beginClause();
+
+	/**
+	 * Tells whether a literal is not in the current clause yet.
+	 *
+	 * @param p_value
+	 *            the literal read, a non-null integer
+	 *
+	 * @return true if the literal must be added to the clause
 	 */
-	std::unique_ptr<std::vector<RawLiteral>> parseClause(std::string p_line);
+	bool addLiteral(int p_value);
 
+private:
+	/** The number of threads parsing a big file. */
+	unsigned int m_threads;
 
 	/**
-	 * Searches a literal in a list of literals.
-	 * 
-	 * @param p_literal
-	 *            the literal to search
-	 * @param p_literals
-	 *            the list of literals
-	 * 
-	 * @return -1 if -p_literal appears in p_literals
-	 *          0 if p_literal does not appear in p_literals
-	 *          1 if p_literal appears in p_literals
+	 * The signed stamp of the clause where each variable was last seen,
+	 * by variable id: a variable already in the current clause has the
+	 * current stamp, negated if it is negative.
 	 */
-	int existsLiteral(RawLiteral& p_literal, std::vector<RawLiteral>& p_literals);
+	std::vector<int> m_stamps;
+
+	/** The stamp of the current clause. */
+	int m_stamp;
+
+	/** Whether the current clause has a literal and its negation. */
+	bool m_tautology;
+
+	/** The literals of the current clause. */
+	std::vector<RawLiteral> m_literals;
 };
 
 } // namespace sat
@@ -0,0 +1,338 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "CnfReader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Decompressor.h"
+#include "IntegerScanner.h"
+#include "utils.h"
+#include "log.h"
+
+
+namespace sat {
+
+// CONSTRUCTORS
+/**
+ * Opens a file.
+ * The standard input is read but not closed by the reader.
+ *
+ * @param p_filename
+ *            the name of the file to read, or "-" for the standard input
+ */
+CnfReader::CnfReader(const char* p_filename) :
+m_descriptor(-1),
+m_ownsDescriptor(false),
+m_buffer(std::make_unique<char[]>(BUFFER_SIZE)),
+m_data(m_buffer.get()),
+m_position(0),
+m_size(0),
+m_consumed(0),
+m_line(1),
+m_origin(nullptr),
+m_failed(false),
+m_decompressor() {
+	if (std::strcmp(p_filename, "-") == 0)
+		m_descriptor = STDIN_FILENO;
+	else {
+		m_descriptor = ::open(p_filename, O_RDONLY);
+		m_ownsDescriptor = true;
+	}
+	if (m_ownsDescriptor && m_descriptor >= 0)
+		::posix_fadvise(m_descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+	if (m_descriptor >= 0)
+		detectCompression();
+}
+
+
+/**
+ * Reads a part of a file already in memory.
+ * The characters are read in place, there is no chunk to refill.
+ *
+ * @param p_begin
+ *            the first character to read
+ * @param p_end
+ *            the end of the characters to read
+ * @param p_origin
+ *            the start of the file, from which the lines are counted
+ */
+CnfReader::CnfReader(const char* p_begin, const char* p_end, const char* p_origin) :
+m_descriptor(-1),
+m_ownsDescriptor(false),
+m_buffer(),
+m_data(p_begin),
+m_position(0),
+m_size(static_cast<std::size_t>(p_end - p_begin)),
+m_consumed(0),
+m_line(1),
+m_origin(p_origin),
+m_failed(false),
+m_decompressor() {
+}
+
+
+/**
+ * Closes the file.
+ * The decompression is stopped first, as it reads the file.
+ */
+CnfReader::~CnfReader() {
+	m_decompressor.reset();
+	if (m_ownsDescriptor && m_descriptor >= 0)
+		::close(m_descriptor);
+}
+
+
+// METHODS
+/**
+ * Tells whether the file could be opened.
+ */
+bool CnfReader::isOpen() const {
+	return m_descriptor >= 0 || isNull(m_buffer);
+}
+
+
+/**
+ * Tells whether the input could not be read to its end, because of a
+ * read error or a damaged compressed file.
+ */
+bool CnfReader::failed() const {
+	return m_failed;
+}
+
+
+/**
+ * Gives the number of the current line, starting from 1.
+ * In a part of a file in memory, the line breaks are counted from the
+ * start of the file when the line is asked for, so that they cost nothing
+ * while the characters are scanned.
+ *
+ * @return the number of the current line
+ */
+unsigned long CnfReader::line() const {
+	if (notNull(m_origin))
+		return 1 + std::count(m_origin, m_data + m_position, '\n');
+	return m_line;
+}
+
+
+/**
+ * Gives the number of characters read so far.
+ */
+std::size_t CnfReader::offset() const {
+	return m_consumed + m_position;
+}
+
+
+/**
+ * Skips the spaces, tabulations and carriage returns.
+ */
+void CnfReader::skipBlanks() {
+	while (isBlank(peek()))
+		++m_position;
+}
+
+
+/**
+ * Skips the blanks and the line breaks.
+ */
+void CnfReader::skipWhitespace() {
+	for (auto character = peek(); isBlank(character) || character == '\n'; character = peek())
+		skip();
+}
+
+
+/**
+ * Moves to the start of the next line.
+ * The line break is searched chunk by chunk.
+ */
+void CnfReader::skipLine() {
+	while (peek() != END) {
+		auto start = m_data + m_position;
+		auto newline = static_cast<const char*>(std::memchr(start, '\n', m_size - m_position));
+		if (notNull(newline)) {
+			m_position += newline - start + 1;
+			++m_line;
+			return;
+		}
+		m_position = m_size;
+	}
+}
+
+
+/**
+ * Skips the characters up to the next blank or line break.
+ */
+void CnfReader::skipToken() {
+	while (!isSeparator(peek()))
+		++m_position;
+}
+
+
+/**
+ * Reads a signed integer token.
+ * The digits are accumulated as they are read, and the value is rejected
+ * as soon as it does not fit in an int.
+ *
+ * @param p_value
+ *            receives the integer
+ *
+ * @return false if there is no valid integer at the current position
+ */
+bool CnfReader::readInteger(int& p_value) {
+	auto negative = (peek() == '-');
+	if (negative)
+		++m_position;
+
+	long value = 0;
+	auto digits = 0;
+	for (auto character = peek(); character >= '0' && character <= '9'; character = peek()) {
+		value = value * 10 + (character - '0');
+		if (value > std::numeric_limits<int>::max())
+			return false;
+		++digits;
+		++m_position;
+	}
+	if (digits == 0 || !isSeparator(peek()))
+		return false;
+
+	p_value = negative ? -static_cast<int>(value) : static_cast<int>(value);
+	return true;
+}
+
+
+/**
+ * Reads the integer tokens that follow in the current chunk, in bulk.
+ * The characters are given to the integer scanner, which works on blocks
+ * of the chunk and leaves the end of the chunk alone.
+ *
+ * @param p_values
+ *            receives the integers read
+ * @param p_capacity
+ *            the number of integers p_values can hold
+ *
+ * @return the number of integers read
+ */
+std::size_t CnfReader::readIntegers(int* p_values, std::size_t p_capacity) {
+	auto start = m_data + m_position;
+	std::size_t count = 0;
+	auto length = IntegerScanner::scan(start, m_data + m_size, p_values, p_capacity, count);
+	if (isNull(m_origin))
+		m_line += std::count(start, start + length, '\n');
+	m_position += length;
+	return count;
+}
+
+
+/**
+ * Reads a word token, made of the characters up to the next blank or line
+ * break, and compares it to the expected one.
+ *
+ * @param p_word
+ *            the expected word
+ *
+ * @return true if the word read is the expected one
+ */
+bool CnfReader::readWord(const char* p_word) {
+	auto matches = true;
+	for (auto character = peek(); !isSeparator(character); character = peek()) {
+		matches = matches && *p_word == character;
+		if (matches)
+			++p_word;
+		++m_position;
+	}
+	return matches && *p_word == '\0';
+}
+
+
+/**
+ * Reads the first characters of the file, and starts decompressing it if
+ * they show a compression format.
+ * The characters read are kept in the buffer for a file that is not
+ * compressed, or given to the decompressor. A file compressed with a
+ * format that this build cannot read is closed.
+ */
+void CnfReader::detectCompression() {
+	while (m_size < Decompressor::MAGIC_SIZE) {
+		auto count = ::read(m_descriptor, m_buffer.get() + m_size, BUFFER_SIZE - m_size);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			break;
+		m_size += count;
+	}
+
+	auto format = Decompressor::detect(m_buffer.get(), m_size);
+	if (format == Decompressor::Format::NONE)
+		return;
+
+	if (!Decompressor::isSupported(format)) {
+		log_error(log_cnf, "The file is compressed with %s, which this build cannot read.", Decompressor::name(format));
+		if (m_ownsDescriptor)
+			::close(m_descriptor);
+		m_descriptor = -1;
+		m_size = 0;
+		m_failed = true;
+		return;
+	}
+
+	log_debug(log_cnf, "Decompressing the %s file.", Decompressor::name(format));
+	m_decompressor = std::make_unique<Decompressor>(format, m_descriptor, m_buffer.get(), m_size);
+	m_size = 0;
+}
+
+
+/**
+ * Reads the next chunk of the input into the buffer, or takes the next
+ * decompressed chunk.
+ * The reads interrupted by a signal are restarted.
+ *
+ * @return false at the end of the input, if the input cannot be read,
+ *         or for a part of a file in memory
+ */
+bool CnfReader::refill() {
+	if (notNull(m_decompressor)) {
+		m_consumed += m_size;
+		m_position = 0;
+		m_size = m_decompressor->next(m_data);
+		if (m_size == 0)
+			m_failed = m_decompressor->failed();
+		return m_size > 0;
+	}
+	if (m_descriptor < 0)
+		return false;
+
+	ssize_t count;
+	do {
+		count = ::read(m_descriptor, m_buffer.get(), BUFFER_SIZE);
+	} while (count < 0 && errno == EINTR);
+
+	if (count < 0) {
+		log_error(log_cnf, "Could not read the file: %s.", std::strerror(errno));
+		m_failed = true;
+	}
+
+	m_consumed += m_size;
+	m_position = 0;
+	m_size = count > 0 ? static_cast<std::size_t>(count) : 0;
+	return m_size > 0;
+}
+
+} // namespace sat
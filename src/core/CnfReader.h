@@ -0,0 +1,242 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef CNF_READER_H
+#define CNF_READER_H
+
+#include <cstddef>
+#include <memory>
+
+
+namespace sat {
+
+class Decompressor;
+
+
+/**
+ * @brief Reads the characters and the integers of a DIMACS file.
+ * The file is read in chunks into a buffer of a fixed size, so that files
+ * of any size, and the standard input, are read in bounded memory. A part
+ * of a file already in memory can also be read in place.
+ *
+ * The files compressed with gzip, xz or bzip2 are recognized from their
+ * first characters, and decompressed on the fly on another thread.
+ *
+ * The scanning methods only look at the current character, so a token may
+ * span two chunks.
+ */
+class CnfReader {
+public:
+	/** The value returned by #peek() at the end of the input. */
+	static constexpr int END = -1;
+
+	/** The size of the chunks read from the input. */
+	static constexpr std::size_t BUFFER_SIZE = 1 << 20;
+
+	/**
+	 * Opens a file.
+	 *
+	 * @param p_filename
+	 *            the name of the file to read, or "-" for the standard input
+	 */
+	explicit CnfReader(const char* p_filename);
+
+	/**
+	 * Reads a part of a file already in memory.
+	 *
+	 * @param p_begin
+	 *            the first character to read
+	 * @param p_end
+	 *            the end of the characters to read
+	 * @param p_origin
+	 *            the start of the file, from which the lines are counted
+	 */
+	CnfReader(const char* p_begin, const char* p_end, const char* p_origin);
+
+	CnfReader(const CnfReader&) = delete;
+	CnfReader& operator=(const CnfReader&) = delete;
+
+	/**
+	 * Closes the file.
+	 */
+	~CnfReader();
+
+	/**
+	 * Tells whether the file could be opened.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Tells whether the input could not be read to its end, because of a
+	 * read error or a damaged compressed file.
+	 * The characters read before are then only a part of the file.
+	 */
+	bool failed() const;
+
+	/**
+	 * Gives the number of the current line, starting from 1.
+	 */
+	unsigned long line() const;
+
+	/**
+	 * Gives the number of characters read so far.
+	 */
+	std::size_t offset() const;
+
+	/**
+	 * Gives the current character.
+	 *
+	 * @return the current character,
+	 *         or END at the end of the input
+	 */
+	int peek() {
+		if (m_position == m_size && !refill())
+			return END;
+		return static_cast<unsigned char>(m_data[m_position]);
+	}
+
+	/**
+	 * Moves to the next character.
+	 */
+	void skip() {
+		if (m_data[m_position++] == '\n')
+			++m_line;
+	}
+
+	/**
+	 * Skips the spaces, tabulations and carriage returns.
+	 */
+	void skipBlanks();
+
+	/**
+	 * Skips the blanks and the line breaks.
+	 */
+	void skipWhitespace();
+
+	/**
+	 * Moves to the start of the next line.
+	 */
+	void skipLine();
+
+	/**
+	 * Skips the characters up to the next blank or line break.
+	 */
+	void skipToken();
+
+	/**
+	 * Reads a signed integer token.
+	 * The integer must be followed by a blank, a line break or the end of
+	 * the input; nothing is read otherwise.
+	 *
+	 * @param p_value
+	 *            receives the integer
+	 *
+	 * @return false if there is no valid integer at the current position
+	 */
+	bool readInteger(int& p_value);
+
+	/**
+	 * Reads the integer tokens that follow in the current chunk, in bulk.
+	 * The reading stops before anything that is not whitespace or a valid
+	 * integer, and near the end of the chunk: what is left must be read
+	 * with the other methods.
+	 *
+	 * @param p_values
+	 *            receives the integers read
+	 * @param p_capacity
+	 *            the number of integers p_values can hold
+	 *
+	 * @return the number of integers read
+	 */
+	std::size_t readIntegers(int* p_values, std::size_t p_capacity);
+
+	/**
+	 * Reads a word token, made of the characters up to the next blank or
+	 * line break, and compares it to the expected one.
+	 *
+	 * @param p_word
+	 *            the expected word
+	 *
+	 * @return true if the word read is the expected one
+	 */
+	bool readWord(const char* p_word);
+
+	/**
+	 * Tells whether a character separates two tokens on a line.
+	 */
+	static bool isBlank(int p_character) {
+		return p_character == ' ' || p_character == '\t' || p_character == '\r';
+	}
+
+	/**
+	 * Tells whether a character ends a token.
+	 */
+	static bool isSeparator(int p_character) {
+		return isBlank(p_character) || p_character == '\n' || p_character == END;
+	}
+
+protected:
+	/**
+	 * Reads the first characters of the file, and starts decompressing it
+	 * if they show a compression format.
+	 */
+	void detectCompression();
+
+	/**
+	 * Reads the next chunk of the input into the buffer.
+	 *
+	 * @return false at the end of the input
+	 */
+	bool refill();
+
+private:
+	/** The descriptor of the file read, negative for a part of a file in memory. */
+	int m_descriptor;
+
+	/** Whether the descriptor is closed with the reader. */
+	bool m_ownsDescriptor;
+
+	/** The buffer the chunks are read into, null for a part of a file in memory. */
+	std::unique_ptr<char[]> m_buffer;
+
+	/** The current chunk. */
+	const char* m_data;
+
+	/** The position of the current character in the chunk. */
+	std::size_t m_position;
+
+	/** The number of characters in the chunk. */
+	std::size_t m_size;
+
+	/** The number of characters of the previous chunks. */
+	std::size_t m_consumed;
+
+	/** The number of the current line, when the file is read in chunks. */
+	unsigned long m_line;
+
+	/** The start of the file, when a part of it is read in memory. */
+	const char* m_origin;
+
+	/** Whether the input could not be read to its end. */
+	bool m_failed;
+
+	/** The decompression of a compressed file, which gives the chunks instead of the buffer. */
+	std::unique_ptr<Decompressor> m_decompressor;
+};
+
+} // namespace sat
+
+#endif // CNF_READER_H
@@ -0,0 +1,90 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "CnfWriter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+#include "Variable.h"
+#include "log.h"
+
+
+namespace sat {
+
+// METHODS
+/**
+ * Writes a SAT problem to a CNF file.
+ *
+ * @param p_filename
+ *            the name of the file to write
+ * @param p_formula
+ *            the formula to write
+ *
+ * @return false if the file could not be written
+ */
+bool CnfWriter::writeProblem(char* p_filename, Formula& p_formula) {
+	log_debug(log_cnf, "Writing problem to CNF file '%s'...", p_filename);
+
+	std::ofstream file(p_filename);
+	if (!file.is_open()) {
+		log_error(log_cnf, "Could not open file '%s'.", p_filename);
+		return false;
+	}
+
+	writeProblem(file, p_formula);
+	file.close();
+	if (file.fail()) {
+		log_error(log_cnf, "Could not write file '%s'.", p_filename);
+		return false;
+	}
+
+	log_info(log_cnf, "Problem written to CNF file '%s'.", p_filename);
+	return true;
+}
+
+
+/**
+ * Writes a SAT problem to a stream.
+ * The clauses are written by increasing id, so that the same formula
+ * always gives the same file.
+ *
+ * @param p_outStream
+ *            the stream to write to
+ * @param p_formula
+ *            the formula to write
+ */
+void CnfWriter::writeProblem(std::ostream& p_outStream, Formula& p_formula) {
+	Id maxVariableId = 0;
+	for (auto variable = p_formula.beginVariable(); variable != p_formula.endVariable(); ++variable)
+		maxVariableId = std::max(maxVariableId, (*variable)->id());
+
+	std::vector<std::shared_ptr<Clause>> clauses(p_formula.beginClause(), p_formula.endClause());
+	std::sort(clauses.begin(), clauses.end(), [](const auto& first, const auto& second) {
+		return first->id() < second->id();
+	});
+
+	p_outStream << "p cnf " << maxVariableId << " " << clauses.size() << "\n";
+	for (const auto& clause : clauses) {
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			p_outStream << literal->sign() * static_cast<int>(literal->id()) << " ";
+		p_outStream << "0\n";
+	}
+}
+
+} // namespace sat
@@ -0,0 +1,58 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef CNF_WRITER_H
+#define CNF_WRITER_H
+
+#include <ostream>
+#include "Formula.h"
+
+
+namespace sat {
+
+/**
+ * @brief Writes problems in the DIMACS CNF format.
+ * The variables keep their id, so the header gives the biggest id used
+ * and not the number of variables.
+ */
+class CnfWriter {
+public:
+	/**
+	 * Writes a SAT problem to a CNF file.
+	 *
+	 * @param p_filename
+	 *            the name of the file to write
+	 * @param p_formula
+	 *            the formula to write
+	 *
+	 * @return false if the file could not be written
+	 */
+	bool writeProblem(char* p_filename, Formula& p_formula);
+
+	/**
+	 * Writes a SAT problem to a stream.
+	 *
+	 * @param p_outStream
+	 *            the stream to write to
+	 * @param p_formula
+	 *            the formula to write
+	 */
+	void writeProblem(std::ostream& p_outStream, Formula& p_formula);
+};
+
+} // namespace sat
+
+#endif // CNF_WRITER_H
@@ -0,0 +1,97 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "ComponentSolver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Formula.h"
+#include "FormulaComponents.h"
+#include "log.h"
+
+
+namespace sat {
+namespace solver {
+
+
+// CONSTRUCTORS
+/**
+ * Creates a solver.
+ *
+ * @param p_components
+ *            the components of the formula to solve
+ * @param p_solve
+ *            the function that solves each component
+ * @param p_threads
+ *            the number of threads, at least one
+ */
+ComponentSolver::ComponentSolver(const FormulaComponents& p_components, SolvingFunction p_solve, unsigned int p_threads) :
+m_components(p_components),
+m_solve(std::move(p_solve)),
+m_threads(std::max(p_threads, 1u)) {
+}
+
+
+// METHODS
+/**
+ * Gives the valuation.
+ */
+const Valuation& ComponentSolver::getValuation() const {
+	return m_valuation;
+}
+
+
+/**
+ * Solves all the components and merges their models.
+ * The components are sorted from the biggest to the smallest, and each
+ * thread takes the next one until none is left. The calling thread is
+ * one of the workers.
+ * Once a component is found unsatisfiable, the components not started yet are skipped.
+ *
+ * @return the valuation of the whole formula
+ */
+Valuation& ComponentSolver::solve() {
+	auto count = m_components.count();
+	std::vector<Valuation> valuations(count);
+	std::atomic<unsigned int> next(0);
+	std::atomic<bool> unsatisfiable(false);
+
+	auto work = [this, count, &valuations, &next, &unsatisfiable]() {
+		for (auto index = next++; index < count && !unsatisfiable; index = next++) {
+			auto formula = m_components.build(index);
+			auto valuation = m_solve(*formula);
+			valuations[index] = m_components.restore(valuation);
+			if (valuations[index].isUnsatisfiable())
+				unsatisfiable = true;
+		}
+	};
+
+	{
+		std::vector<std::jthread> workers;
+		for (auto i = 1u; i < std::min(m_threads, count); ++i)
+			workers.emplace_back(work);
+		work();
+	}
+
+	m_valuation = m_components.merge(valuations);
+	log_info(log_dpll, "%u components solved on %u threads.", count, std::min(m_threads, count));
+	return m_valuation;
+}
+
+} // namespace sat::solver
+} // namespace sat
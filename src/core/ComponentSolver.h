@@ -0,0 +1,93 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef COMPONENT_SOLVER_H
+#define COMPONENT_SOLVER_H
+
+#include <functional>
+#include "Solver.h"
+#include "Valuation.h"
+
+
+namespace sat {
+
+class Formula;
+class FormulaComponents;
+
+namespace solver {
+
+
+/**
+ * @brief Solves the independent components of a formula concurrently.
+ *
+ * Each component is built as a formula of its own and given to a solving
+ * function, on a pool of threads that take the components from the biggest
+ * to the smallest. The models of the components are then merged into a
+ * model of the whole formula. Solving k independent parts separately turns
+ * a product of search spaces into a sum.
+ *
+ * The solving function is called concurrently from several threads, with a
+ * different formula each time: whatever it shares between the calls must be
+ * protected by the caller.
+ */
+class ComponentSolver : public Solver {
+public:
+	/** Solves a single formula. */
+	using SolvingFunction = std::function<Valuation(Formula&)>;
+
+	/**
+	 * Creates a solver.
+	 *
+	 * @param p_components
+	 *            the components of the formula to solve
+	 * @param p_solve
+	 *            the function that solves each component
+	 * @param p_threads
+	 *            the number of threads, at least one
+	 */
+	ComponentSolver(const FormulaComponents& p_components, SolvingFunction p_solve, unsigned int p_threads);
+
+	/**
+	 * Gives the valuation.
+	 */
+	const Valuation& getValuation() const override;
+
+	/**
+	 * Solves all the components and merges their models.
+	 * Once a component is found unsatisfiable, the components not started yet are skipped.
+	 *
+	 * @return the valuation of the whole formula
+	 */
+	Valuation& solve() override;
+
+private:
+	/** The components of the formula. */
+	const FormulaComponents& m_components;
+
+	/** The function that solves each component. */
+	SolvingFunction m_solve;
+
+	/** The number of threads. */
+	unsigned int m_threads;
+
+	/** The merged valuation. */
+	Valuation m_valuation;
+};
+
+} // namespace sat::solver
+} // namespace sat
+
+#endif // COMPONENT_SOLVER_H
@@ -0,0 +1,558 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "Decompressor.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef WITH_LZMA
+#include <lzma.h>
+#endif
+#ifdef WITH_BZIP2
+#include <bzlib.h>
+#endif
+#include "utils.h"
+#include "log.h"
+
+
+namespace sat {
+
+/**
+ * @brief The decompression of a format.
+ * The compressed characters are read from the file into an input buffer,
+ * which starts with the characters read to recognize the format.
+ */
+class Decompressor::Codec {
+public:
+	/** The number of compressed characters read at once, at least. */
+	static constexpr std::size_t INPUT_SIZE = 256 << 10;
+
+	/**
+	 * Creates a codec.
+	 *
+	 * @param p_descriptor
+	 *            the descriptor the compressed file is read from
+	 * @param p_prefix
+	 *            the first characters of the file, already read
+	 * @param p_size
+	 *            the number of characters of p_prefix
+	 */
+	Codec(int p_descriptor, const char* p_prefix, std::size_t p_size) :
+	m_descriptor(p_descriptor),
+	m_input(std::make_unique<char[]>(std::max(p_size, INPUT_SIZE))),
+	m_ended(false),
+	m_failed(false),
+	m_capacity(std::max(p_size, INPUT_SIZE)),
+	m_available(p_size) {
+		std::memcpy(m_input.get(), p_prefix, p_size);
+	}
+
+	virtual ~Codec() = default;
+
+	/**
+	 * Decompresses characters.
+	 *
+	 * @param p_output
+	 *            receives the decompressed characters
+	 * @param p_capacity
+	 *            the number of characters p_output can hold
+	 *
+	 * @return the number of characters decompressed, less than p_capacity
+	 *         only at the end of the file, 0 once it is reached
+	 */
+	std::size_t decompress(char* p_output, std::size_t p_capacity) {
+		if (m_ended)
+			return 0;
+		return inflate(p_output, p_capacity);
+	}
+
+	/**
+	 * Tells whether the file could not be read or decompressed to its end.
+	 */
+	bool failed() const {
+		return m_failed;
+	}
+
+protected:
+	/**
+	 * Decompresses characters until the output is full, or the end of the
+	 * file is reached: the compressed data ends, or an error occurs.
+	 *
+	 * @param p_output
+	 *            receives the decompressed characters
+	 * @param p_capacity
+	 *            the number of characters p_output can hold
+	 *
+	 * @return the number of characters decompressed
+	 */
+	virtual std::size_t inflate(char* p_output, std::size_t p_capacity) = 0;
+
+	/**
+	 * Ends the decompression on an error.
+	 */
+	void fail() {
+		m_ended = true;
+		m_failed = true;
+	}
+
+	/**
+	 * Reads the next compressed characters, once the previous ones are used.
+	 *
+	 * @return the number of characters read,
+	 *         0 at the end of the file
+	 */
+	std::size_t readInput() {
+		if (m_available > 0) {
+			auto available = m_available;
+			m_available = 0;
+			return available;
+		}
+
+		ssize_t count;
+		do {
+			count = ::read(m_descriptor, m_input.get(), m_capacity);
+		} while (count < 0 && errno == EINTR);
+		if (count < 0) {
+			log_error(log_cnf, "Could not read the compressed file: %s.", std::strerror(errno));
+			m_failed = true;
+		}
+		return count > 0 ? static_cast<std::size_t>(count) : 0;
+	}
+
+	/** The descriptor the compressed file is read from. */
+	int m_descriptor;
+
+	/** The compressed characters. */
+	std::unique_ptr<char[]> m_input;
+
+	/** Whether the end of the decompressed file is reached. */
+	bool m_ended;
+
+	/** Whether the decompression ended on an error. */
+	bool m_failed;
+
+private:
+	/** The number of characters the input can hold. */
+	std::size_t m_capacity;
+
+	/** The number of characters of the input not given yet. */
+	std::size_t m_available;
+};
+
+
+namespace {
+
+#ifdef WITH_ZLIB
+/**
+ * @brief Decompresses gzip files with zlib.
+ * The members of a file made of several gzip members are decompressed in
+ * sequence.
+ */
+class GzipCodec : public Decompressor::Codec {
+public:
+	GzipCodec(int p_descriptor, const char* p_prefix, std::size_t p_size) :
+	Codec(p_descriptor, p_prefix, p_size),
+	m_stream() {
+		if (inflateInit2(&m_stream, 15 + 16) != Z_OK) {
+			log_error(log_cnf, "Could not initialize zlib.");
+			fail();
+		}
+	}
+
+	~GzipCodec() {
+		inflateEnd(&m_stream);
+	}
+
+protected:
+	std::size_t inflate(char* p_output, std::size_t p_capacity) override {
+		m_stream.next_out = reinterpret_cast<Bytef*>(p_output);
+		m_stream.avail_out = p_capacity;
+		while (m_stream.avail_out > 0 && !m_ended) {
+			if (m_stream.avail_in == 0) {
+				m_stream.avail_in = readInput();
+				m_stream.next_in = reinterpret_cast<Bytef*>(m_input.get());
+				if (m_stream.avail_in == 0) {
+					log_warn(log_cnf, "The gzip file is truncated.");
+					fail();
+					break;
+				}
+			}
+
+			auto status = ::inflate(&m_stream, Z_NO_FLUSH);
+			if (status == Z_STREAM_END) {
+				if (m_stream.avail_in == 0) {
+					m_stream.avail_in = readInput();
+					m_stream.next_in = reinterpret_cast<Bytef*>(m_input.get());
+				}
+				if (m_stream.avail_in == 0)
+					m_ended = true;
+				else
+					inflateReset(&m_stream);
+			}
+			else if (status != Z_OK) {
+				log_error(log_cnf, "Invalid gzip data: %s.", notNull(m_stream.msg) ? m_stream.msg : "unknown error");
+				fail();
+			}
+		}
+		return p_capacity - m_stream.avail_out;
+	}
+
+private:
+	/** The state of zlib. */
+	z_stream m_stream;
+};
+#endif
+
+
+#ifdef WITH_LZMA
+/**
+ * @brief Decompresses xz files with liblzma.
+ * The streams of a file made of several xz streams are decompressed in
+ * sequence.
+ */
+class XzCodec : public Decompressor::Codec {
+public:
+	XzCodec(int p_descriptor, const char* p_prefix, std::size_t p_size) :
+	Codec(p_descriptor, p_prefix, p_size),
+	m_stream(LZMA_STREAM_INIT),
+	m_action(LZMA_RUN) {
+		if (lzma_stream_decoder(&m_stream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+			log_error(log_cnf, "Could not initialize liblzma.");
+			fail();
+		}
+	}
+
+	~XzCodec() {
+		lzma_end(&m_stream);
+	}
+
+protected:
+	std::size_t inflate(char* p_output, std::size_t p_capacity) override {
+		m_stream.next_out = reinterpret_cast<uint8_t*>(p_output);
+		m_stream.avail_out = p_capacity;
+		while (m_stream.avail_out > 0 && !m_ended) {
+			if (m_stream.avail_in == 0 && m_action == LZMA_RUN) {
+				m_stream.avail_in = readInput();
+				m_stream.next_in = reinterpret_cast<const uint8_t*>(m_input.get());
+				if (m_stream.avail_in == 0)
+					m_action = LZMA_FINISH;
+			}
+
+			auto status = lzma_code(&m_stream, m_action);
+			if (status == LZMA_STREAM_END)
+				m_ended = true;
+			else if (status != LZMA_OK) {
+				log_error(log_cnf, "Invalid or truncated xz data, error %d.", status);
+				fail();
+			}
+		}
+		return p_capacity - m_stream.avail_out;
+	}
+
+private:
+	/** The state of liblzma. */
+	lzma_stream m_stream;
+
+	/** LZMA_FINISH once the whole file is read. */
+	lzma_action m_action;
+};
+#endif
+
+
+#ifdef WITH_BZIP2
+/**
+ * @brief Decompresses bzip2 files with libbz2.
+ * The streams of a file made of several bzip2 streams, as written by the
+ * parallel compressors, are decompressed in sequence.
+ */
+class Bzip2Codec : public Decompressor::Codec {
+public:
+	Bzip2Codec(int p_descriptor, const char* p_prefix, std::size_t p_size) :
+	Codec(p_descriptor, p_prefix, p_size),
+	m_stream() {
+		if (BZ2_bzDecompressInit(&m_stream, 0, 0) != BZ_OK) {
+			log_error(log_cnf, "Could not initialize libbz2.");
+			fail();
+		}
+	}
+
+	~Bzip2Codec() {
+		BZ2_bzDecompressEnd(&m_stream);
+	}
+
+protected:
+	std::size_t inflate(char* p_output, std::size_t p_capacity) override {
+		m_stream.next_out = p_output;
+		m_stream.avail_out = p_capacity;
+		while (m_stream.avail_out > 0 && !m_ended) {
+			if (m_stream.avail_in == 0) {
+				m_stream.avail_in = readInput();
+				m_stream.next_in = m_input.get();
+				if (m_stream.avail_in == 0) {
+					log_warn(log_cnf, "The bzip2 file is truncated.");
+					fail();
+					break;
+				}
+			}
+
+			auto status = BZ2_bzDecompress(&m_stream);
+			if (status == BZ_STREAM_END) {
+				if (m_stream.avail_in == 0) {
+					m_stream.avail_in = readInput();
+					m_stream.next_in = m_input.get();
+				}
+				if (m_stream.avail_in == 0) {
+					m_ended = true;
+					break;
+				}
+				// Restart on the next stream, keeping its input
+				auto input = m_stream.next_in;
+				auto available = m_stream.avail_in;
+				auto output = m_stream.next_out;
+				auto room = m_stream.avail_out;
+				BZ2_bzDecompressEnd(&m_stream);
+				if (BZ2_bzDecompressInit(&m_stream, 0, 0) != BZ_OK) {
+					log_error(log_cnf, "Could not initialize libbz2.");
+					fail();
+				}
+				m_stream.next_in = input;
+				m_stream.avail_in = available;
+				m_stream.next_out = output;
+				m_stream.avail_out = room;
+			}
+			else if (status != BZ_OK) {
+				log_error(log_cnf, "Invalid bzip2 data, error %d.", status);
+				fail();
+			}
+		}
+		return p_capacity - m_stream.avail_out;
+	}
+
+private:
+	/** The state of libbz2. */
+	bz_stream m_stream;
+};
+#endif
+
+} // anonymous namespace
+
+
+// CONSTRUCTORS
+/**
+ * Starts decompressing a file.
+ * The thread is started once the ring is ready.
+ *
+ * @param p_format
+ *            the compression format of the file, supported
+ * @param p_descriptor
+ *            the descriptor the rest of the compressed file is read from
+ * @param p_prefix
+ *            the first characters of the file, already read
+ * @param p_size
+ *            the number of characters of p_prefix
+ */
+Decompressor::Decompressor(Format p_format, [[maybe_unused]] int p_descriptor, [[maybe_unused]] const char* p_prefix, [[maybe_unused]] std::size_t p_size) :
+m_codec(),
+m_chunks(),
+m_sizes(RING_SIZE, 0),
+m_produced(0),
+m_released(0),
+m_holding(false),
+m_failed(false),
+m_mutex(),
+m_changed(),
+m_thread() {
+	switch (p_format) {
+#ifdef WITH_ZLIB
+		case Format::GZIP:
+			m_codec = std::make_unique<GzipCodec>(p_descriptor, p_prefix, p_size);
+			break;
+#endif
+#ifdef WITH_LZMA
+		case Format::XZ:
+			m_codec = std::make_unique<XzCodec>(p_descriptor, p_prefix, p_size);
+			break;
+#endif
+#ifdef WITH_BZIP2
+		case Format::BZIP2:
+			m_codec = std::make_unique<Bzip2Codec>(p_descriptor, p_prefix, p_size);
+			break;
+#endif
+		default:
+			log_error(log_cnf, "Files compressed with %s cannot be read.", name(p_format));
+			m_produced = 1;
+			m_failed = true;
+			return;
+	}
+
+	for (std::size_t chunk = 0; chunk < RING_SIZE; ++chunk)
+		m_chunks.push_back(std::make_unique<char[]>(CHUNK_SIZE));
+	m_thread = std::jthread([this](std::stop_token p_stop) { run(p_stop); });
+}
+
+
+/**
+ * Stops the decompression.
+ * The thread is stopped, even if it waits for room in the ring, before the
+ * ring and the codec are destroyed.
+ */
+Decompressor::~Decompressor() {
+	if (m_thread.joinable()) {
+		m_thread.request_stop();
+		m_thread.join();
+	}
+}
+
+
+// METHODS
+/**
+ * Recognizes the compression format of a file from its first characters.
+ *
+ * @param p_data
+ *            the first characters of the file
+ * @param p_size
+ *            the number of characters given, MAGIC_SIZE are enough
+ *
+ * @return the format, NONE for a file that is not compressed
+ */
+Decompressor::Format Decompressor::detect(const char* p_data, std::size_t p_size) {
+	auto matches = [&](const char* p_magic, std::size_t p_length) {
+		return p_size >= p_length && std::memcmp(p_data, p_magic, p_length) == 0;
+	};
+	if (matches("\x1F\x8B", 2))
+		return Format::GZIP;
+	if (matches("\xFD" "7zXZ\0", 6))
+		return Format::XZ;
+	if (matches("BZh", 3) && p_size >= 4 && p_data[3] >= '1' && p_data[3] <= '9')
+		return Format::BZIP2;
+	return Format::NONE;
+}
+
+
+/**
+ * Tells whether this build can decompress a format.
+ */
+bool Decompressor::isSupported(Format p_format) {
+	switch (p_format) {
+#ifdef WITH_ZLIB
+		case Format::GZIP:
+			return true;
+#endif
+#ifdef WITH_LZMA
+		case Format::XZ:
+			return true;
+#endif
+#ifdef WITH_BZIP2
+		case Format::BZIP2:
+			return true;
+#endif
+		default:
+			return false;
+	}
+}
+
+
+/**
+ * Gives the name of a format.
+ */
+const char* Decompressor::name(Format p_format) {
+	switch (p_format) {
+		case Format::GZIP:
+			return "gzip";
+		case Format::XZ:
+			return "xz";
+		case Format::BZIP2:
+			return "bzip2";
+		default:
+			return "none";
+	}
+}
+
+
+/**
+ * Gives the next decompressed chunk, and hands the previous one back.
+ * Waits for the decompressing thread when it is late.
+ *
+ * @param p_data
+ *            receives the characters of the chunk, valid up to the next call
+ *
+ * @return the number of characters of the chunk,
+ *         0 at the end of the file
+ */
+std::size_t Decompressor::next(const char*& p_data) {
+	std::unique_lock lock(m_mutex);
+	if (m_holding) {
+		++m_released;
+		m_holding = false;
+		m_changed.notify_all();
+	}
+	m_changed.wait(lock, [this]() { return m_produced > m_released; });
+
+	auto slot = m_released % RING_SIZE;
+	if (m_chunks.empty() || m_sizes[slot] == 0)
+		return 0;
+	m_holding = true;
+	p_data = m_chunks[slot].get();
+	return m_sizes[slot];
+}
+
+
+/**
+ * Tells whether the file could not be decompressed to its end.
+ * The characters given before the end are then only a part of the file.
+ */
+bool Decompressor::failed() {
+	std::lock_guard lock(m_mutex);
+	return m_failed;
+}
+
+
+/**
+ * Decompresses the chunks as long as there is room in the ring.
+ * A chunk can be written once the reader has handed back the chunk that
+ * was in its place, and the last chunk written is an empty one.
+ *
+ * @param p_stop
+ *            tells when the reader does not want any more chunk
+ */
+void Decompressor::run(std::stop_token p_stop) {
+	for (std::size_t chunk = 0; ; ++chunk) {
+		{
+			std::unique_lock lock(m_mutex);
+			if (!m_changed.wait(lock, p_stop, [&]() { return chunk < m_released + RING_SIZE; }))
+				return;
+		}
+
+		auto size = m_codec->decompress(m_chunks[chunk % RING_SIZE].get(), CHUNK_SIZE);
+		{
+			std::lock_guard lock(m_mutex);
+			m_sizes[chunk % RING_SIZE] = size;
+			m_produced = chunk + 1;
+			m_failed = (size == 0 && m_codec->failed());
+		}
+		m_changed.notify_all();
+
+		if (size == 0)
+			return;
+	}
+}
+
+} // namespace sat
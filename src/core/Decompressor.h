@@ -0,0 +1,158 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef DECOMPRESSOR_H
+#define DECOMPRESSOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace sat {
+
+/**
+ * @brief Decompresses a gzip, xz or bzip2 file on its own thread.
+ * The decompressed characters are written to a ring of chunks, and handed
+ * to the reader one chunk at a time: the decompression of the next chunks
+ * goes on while the reader parses the current one.
+ *
+ * The formats supported depend on the libraries found when building.
+ */
+class Decompressor {
+public:
+	/** The number of characters of a decompressed chunk. */
+	static constexpr std::size_t CHUNK_SIZE = 1 << 20;
+
+	/** The number of chunks of the ring. */
+	static constexpr std::size_t RING_SIZE = 4;
+
+	/** The number of characters needed to recognize a format. */
+	static constexpr std::size_t MAGIC_SIZE = 6;
+
+	/** The compression formats. */
+	enum class Format { NONE, GZIP, XZ, BZIP2 };
+
+	/**
+	 * Recognizes the compression format of a file from its first characters.
+	 *
+	 * @param p_data
+	 *            the first characters of the file
+	 * @param p_size
+	 *            the number of characters given, MAGIC_SIZE are enough
+	 *
+	 * @return the format, NONE for a file that is not compressed
+	 */
+	static Format detect(const char* p_data, std::size_t p_size);
+
+	/**
+	 * Tells whether this build can decompress a format.
+	 */
+	static bool isSupported(Format p_format);
+
+	/**
+	 * Gives the name of a format.
+	 */
+	static const char* name(Format p_format);
+
+	/**
+	 * Starts decompressing a file.
+	 *
+	 * @param p_format
+	 *            the compression format of the file, supported
+	 * @param p_descriptor
+	 *            the descriptor the rest of the compressed file is read from
+	 * @param p_prefix
+	 *            the first characters of the file, already read
+	 * @param p_size
+	 *            the number of characters of p_prefix
+	 */
+	Decompressor(Format p_format, int p_descriptor, const char* p_prefix, std::size_t p_size);
+
+	Decompressor(const Decompressor&) = delete;
+	Decompressor& operator=(const Decompressor&) = delete;
+
+	/**
+	 * Stops the decompression.
+	 */
+	~Decompressor();
+
+	/**
+	 * Gives the next decompressed chunk, and hands the previous one back.
+	 *
+	 * @param p_data
+	 *            receives the characters of the chunk, valid up to the next call
+	 *
+	 * @return the number of characters of the chunk,
+	 *         0 at the end of the file
+	 */
+	std::size_t next(const char*& p_data);
+
+	/**
+	 * Tells whether the file could not be decompressed to its end.
+	 */
+	bool failed();
+
+	/** The decompression of a format, hidden in the implementation. */
+	class Codec;
+
+protected:
+	/**
+	 * Decompresses the chunks as long as there is room in the ring.
+	 *
+	 * @param p_stop
+	 *            tells when the reader does not want any more chunk
+	 */
+	void run(std::stop_token p_stop);
+
+private:
+	/** The decompression of the format of the file. */
+	std::unique_ptr<Codec> m_codec;
+
+	/** The chunks of the ring. */
+	std::vector<std::unique_ptr<char[]>> m_chunks;
+
+	/** The number of characters of each chunk of the ring. */
+	std::vector<std::size_t> m_sizes;
+
+	/** The number of chunks decompressed so far. */
+	std::size_t m_produced;
+
+	/** The number of chunks handed back by the reader. */
+	std::size_t m_released;
+
+	/** Whether the reader holds the chunk after the ones handed back. */
+	bool m_holding;
+
+	/** Whether the decompression ended on an error, set with the last chunk. */
+	bool m_failed;
+
+	/** Protects the counts of chunks. */
+	std::mutex m_mutex;
+
+	/** Signals the changes of the counts of chunks. */
+	std::condition_variable_any m_changed;
+
+	/** The decompressing thread, stopped first on destruction. */
+	std::jthread m_thread;
+};
+
+} // namespace sat
+
+#endif // DECOMPRESSOR_H
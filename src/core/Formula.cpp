@@ -23,6 +23,7 @@
 #include "Clause.h"
 #include "Variable.h"
 #include "Literal.h"
+#include "FormulaListener.h"
 #include "utils.h"
 #include "log.h"
 
@@ -31,10 +32,31 @@ namespace sat {
 
 // CONSTRUCTORS
 Formula::Formula() :
+m_lastClauseId(0),
+m_deferOccurences(false),
 m_builder(*this) {}
 
 
 // METHODS
+/**
+ * Sizes the containers for the expected number of variables and clauses,
+ * so that they do not grow while the formula is loaded.
+ *
+ * @param p_variables
+ *            the expected number of variables, also the biggest expected id
+ * @param p_clauses
+ *            the expected number of clauses
+ */
+void Formula::reserve(unsigned int p_variables, unsigned int p_clauses) {
+	m_variables.reserve(p_variables);
+	m_variablesById.reserve(static_cast<std::size_t>(p_variables) + 1);
+	m_clauses.reserve(p_clauses);
+	if (m_deferOccurences)
+		m_unlinkedClauses.reserve(p_clauses);
+	log_debug(log_formula, "Formula sized for %u variables and %u clauses.", p_variables, p_clauses);
+}
+
+
 /**
  * Initializes a builder object.
  *
@@ -49,16 +71,20 @@ ClauseBuilder& Formula::newClause(Id p_clauseId) {
 
 /**
  * Creates a clause in the formula.
- * The needed variables are created if needed.
+ * The needed variables are created if needed. The variables are linked to
+ * the clause at once, or by #linkOccurences() after #deferOccurences().
  *
  * @param p_clauseId
  *            the identifier of the clause
  * @param p_literals
  *            the raw literals
+ *
+ * @return the clause created
  */
-void Formula::createClause(Id p_clauseId, const std::vector<RawLiteral>& p_literals) {
+const std::shared_ptr<Clause>& Formula::createClause(Id p_clauseId, std::span<const RawLiteral> p_literals) {
 	// Create the clause & add it to the list
 	auto clause = std::make_shared<Clause>(p_clauseId);
+	clause->reserve(p_literals.size());
 	
 	// Link the new clause with its literals
 	for (const auto& literal : p_literals) {
@@ -69,18 +95,78 @@ void Formula::createClause(Id p_clauseId, const std::vector<RawLiteral>& p_liter
 		clause->addLiteral(Literal(variable, literal.sign()));
 
 		// Link variable -> clause
-		variable->addOccurence(clause, literal.sign());
+		if (!m_deferOccurences)
+			variable->addOccurence(clause, literal.sign());
 	}
 
 	// Move the clause to the container (to transfer ownership)
-	m_clauses.insert(std::move(clause));
+	if (m_deferOccurences)
+		m_unlinkedClauses.push_back(clause);
+	const auto& created = *m_clauses.insert(std::move(clause)).first;
+	m_lastClauseId = std::max(m_lastClauseId, p_clauseId);
 	log_debug(log_formula, "Clause %u added.", p_clauseId);
+	return created;
+}
+
+
+/**
+ * Defers the linking of the variables to the new clauses until
+ * #linkOccurences(), for a formula created in bulk.
+ * Until then, the clauses may only be created.
+ */
+void Formula::deferOccurences() {
+	m_deferOccurences = true;
+}
+
+
+/**
+ * Links the variables to the clauses created since #deferOccurences(),
+ * in two passes: the occurences of each variable are counted first, then
+ * laid out in one pool, each variable taking a slice big enough for its
+ * current and new occurences, and filled in the order of the clauses.
+ */
+void Formula::linkOccurences() {
+	m_deferOccurences = false;
+
+	// Count the new occurences of each variable
+	std::vector<unsigned int> positives(m_variablesById.size(), 0);
+	std::vector<unsigned int> negatives(m_variablesById.size(), 0);
+	for (const auto& clause : m_unlinkedClauses)
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			++(literal->isPositive() ? positives : negatives)[literal->id()];
+
+	// Cut the pool in slices
+	std::size_t size = 0;
+	for (Id id = 0; id < m_variablesById.size(); ++id)
+		if (positives[id] + negatives[id] > 0)
+			size += m_variablesById[id]->countOccurences() + positives[id] + negatives[id];
+
+	auto pool = std::make_shared<std::shared_ptr<Clause>[]>(size);
+	std::size_t offset = 0;
+	for (Id id = 0; id < m_variablesById.size(); ++id) {
+		if (positives[id] + negatives[id] == 0)
+			continue;
+
+		const auto& variable = m_variablesById[id];
+		auto occurences = variable->countOccurences() + positives[id] + negatives[id];
+		variable->reserveOccurences(pool, offset, positives[id], negatives[id]);
+		offset += occurences;
+	}
+
+	// Fill the slices
+	for (const auto& clause : m_unlinkedClauses)
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			m_variablesById[literal->id()]->addOccurence(clause, literal->sign());
+
+	log_debug(log_formula, "Occurences of %zu clauses linked.", m_unlinkedClauses.size());
+	std::vector<std::shared_ptr<Clause>>().swap(m_unlinkedClauses);
 }
 
 
 /**
- * Searches a variable with the given id in the list of used variables.
+ * Searches a variable with the given id in the table of variables.
  * If no one is found, a new one is created and added.
+ * An unused variable is moved back to the list of used variables.
  *
  * @param p_variableId
  *            the identifier of the variable to find
@@ -88,17 +174,14 @@ void Formula::createClause(Id p_clauseId, const std::vector<RawLiteral>& p_liter
  * @return the variable, either found or created
  */
 std::shared_ptr<Variable> Formula::findOrCreateVariable(Id p_variableId) {
-	auto variable = std::shared_ptr<Variable>();
-
-	// Search the variable
-	auto match_id([p_variableId](const std::shared_ptr<Variable>& variable) {
-		return variable->id() == p_variableId;
-	});
-	auto iterator = std::find_if(m_variables.cbegin(), m_variables.cend(), std::cref(match_id));
+	if (p_variableId >= m_variablesById.size())
+		m_variablesById.resize(p_variableId + 1);
+	auto& variable = m_variablesById[p_variableId];
 
 	// If the variable was found, select it
-	if (iterator != m_variables.cend()) {
-		variable = *iterator;
+	if (notNull(variable)) {
+		if (variable->isUnused())
+			addVariable(variable);
 		log_debug(log_formula, "Variable x%u found.", variable->id());
 	}
 	// Otherwise, create & add it
@@ -179,6 +262,9 @@ void Formula::removeVariable(const std::shared_ptr<Variable>& p_variable) {
 	m_unusedVariables.insert(p_variable);
 	m_variables.erase(p_variable);
 	log_info(log_formula, "Variable x%u has been removed.", p_variable->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onVariableRemoved(p_variable);
 }
 
 
@@ -193,6 +279,9 @@ void Formula::addVariable(const std::shared_ptr<Variable>& p_variable) {
 	m_unusedVariables.erase(p_variable);
 	p_variable->setUsed();
 	log_info(log_formula, "Variable x%u has been added.", p_variable->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onVariableRestored(p_variable);
 }
 
 
@@ -227,6 +316,9 @@ void Formula::addClause(const std::shared_ptr<Clause>& p_clause) {
 	}
 	
 	log_info(log_formula, "Clause %u added.", p_clause->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onClauseRestored(p_clause);
 }
 
 
@@ -249,8 +341,16 @@ void Formula::addLiteralToClause(const std::shared_ptr<Clause>& p_clause, Litera
 	p_clause->addLiteral(p_literal);
 
 	// Link variable -> clause
-	p_literal.var()->addOccurence(p_clause, p_literal.sign());
+	auto variable = p_literal.var();
+	variable->addOccurence(p_clause, p_literal.sign());
+
+	// Move the variable to the current list if needed
+	if (variable->isUnused())
+		addVariable(variable);
 	log_debug(log_formula, "Literal %sx%u added to clause %u.", (p_literal.isNegative() ? "¬" : ""), p_literal.id(), p_clause->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onClauseGrown(p_clause, p_literal);
 }
 
 
@@ -275,6 +375,9 @@ void Formula::removeClause(const std::shared_ptr<Clause>& p_clause) {
 	m_unusedClauses.insert(p_clause);
 	
 	log_info(log_formula, "Clause %u removed.", p_clause->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onClauseRemoved(p_clause);
 }
 
 
@@ -291,6 +394,33 @@ void Formula::removeLiteralFromClause(const std::shared_ptr<Clause>& p_clause, L
 	p_clause->removeLiteral(p_literal);
 	unlinkVariable(p_clause, p_literal);
 	log_info(log_formula, "Literal %sx%u removed from clause %u.", (p_literal.isPositive() ? "¬" : ""), p_literal.id(), p_clause->id());
+
+	for (const auto& listener : m_listeners)
+		listener.get().onClauseShrunk(p_clause, p_literal);
+}
+
+
+/**
+ * Removes a clause for good, as a simplification does.
+ * Unlike #removeClause(const std::shared_ptr<Clause>&), the clause
+ * is not kept in the unused list and cannot be restored.
+ *
+ * @param p_clause
+ *            the clause
+ */
+void Formula::deleteClause(const std::shared_ptr<Clause>& p_clause) {
+	// Keep the clause alive until it is unlinked
+	auto clause = p_clause;
+	removeClause(clause);
+	m_unusedClauses.erase(clause);
+}
+
+
+/**
+ * Gives an identifier for a new clause, after the ones already created.
+ */
+Id Formula::nextClauseId() const {
+	return m_lastClauseId + 1;
 }
 
 
@@ -310,6 +440,38 @@ bool Formula::hasVariables() const {
 }
 
 
+/**
+ * Gives the number of clauses in the formula.
+ */
+unsigned int Formula::countClauses() const {
+	return m_clauses.size();
+}
+
+
+/**
+ * Gives the number of variables in the formula.
+ */
+unsigned int Formula::countVariables() const {
+	return m_variables.size();
+}
+
+
+/**
+ * 
+ */
+std::unordered_set<std::shared_ptr<Clause>>::iterator Formula::beginClause() {
+	return m_clauses.begin();
+}
+
+
+/**
+ * 
+ */
+std::unordered_set<std::shared_ptr<Clause>>::iterator Formula::endClause() {
+	return m_clauses.end();
+}
+
+
 /**
  * 
  */
@@ -326,6 +488,31 @@ std::unordered_set<std::shared_ptr<Variable>>::iterator Formula::endVariable() {
 }
 
 
+/**
+ * Registers an object to notify of the changes of the formula.
+ *
+ * @param p_listener
+ *            the listener to add
+ */
+void Formula::addListener(FormulaListener& p_listener) {
+	m_listeners.emplace_back(std::ref(p_listener));
+}
+
+
+/**
+ * Unregisters an object added by #addListener(FormulaListener&).
+ *
+ * @param p_listener
+ *            the listener to remove
+ */
+void Formula::removeListener(FormulaListener& p_listener) {
+	auto isListener([&p_listener](const std::reference_wrapper<FormulaListener>& listener) {
+		return &listener.get() == &p_listener;
+	});
+	m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(), std::cref(isListener)), m_listeners.end());
+}
+
+
 /**
  * Logs the current formula to the formula logger.
  */
@@ -17,7 +17,9 @@
 #ifndef FORMULA_H
 #define FORMULA_H
 
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_set>
 #include "ClauseBuilder.h"
@@ -30,14 +32,20 @@ class ClauseBuilder;
 class Clause;
 class Literal;
 class Variable;
+class FormulaListener;
 
 
 class Formula {
 public:
 	Formula();
 
+	void reserve(unsigned int p_variables, unsigned int p_clauses);
+
 	ClauseBuilder& newClause(Id p_clauseId);
-	void createClause(Id p_clauseId, const std::vector<RawLiteral>& p_literals);
+	const std::shared_ptr<Clause>& createClause(Id p_clauseId, std::span<const RawLiteral> p_literals);
+
+	void deferOccurences();
+	void linkOccurences();
 
 	Literal findUnitLiteral() const;
 
@@ -45,15 +53,27 @@ public:
 	void addLiteralToClause(const std::shared_ptr<Clause>& p_clause, Literal p_literal);
 	void removeClause(const std::shared_ptr<Clause>& p_clause);
 	void removeLiteralFromClause(const std::shared_ptr<Clause>& p_clause, Literal p_literal);
+	void deleteClause(const std::shared_ptr<Clause>& p_clause);
+
+	Id nextClauseId() const;
 
 	bool hasClauses() const;
 	bool hasVariables() const;
 
+	unsigned int countClauses() const;
+	unsigned int countVariables() const;
+
+	std::unordered_set<std::shared_ptr<Clause>>::iterator beginClause();
+	std::unordered_set<std::shared_ptr<Clause>>::iterator endClause();
+
 	std::unordered_set<std::shared_ptr<Variable>>::iterator beginVariable();
 	std::unordered_set<std::shared_ptr<Variable>>::iterator endVariable();
 	void removeVariable(const std::shared_ptr<Variable>& p_variable);
 	void addVariable(const std::shared_ptr<Variable>& p_variable);
 
+	void addListener(FormulaListener& p_listener);
+	void removeListener(FormulaListener& p_listener);
+
 	void log() const;
 
 protected:
@@ -67,7 +87,21 @@ private:
 	std::unordered_set<std::shared_ptr<Variable>> m_variables;
 	std::unordered_set<std::shared_ptr<Variable>> m_unusedVariables;
 
+	/** All the variables created, used or not, by id. */
+	std::vector<std::shared_ptr<Variable>> m_variablesById;
+
+	Id m_lastClauseId;
+
+	/** Whether the new clauses are linked to their variables by #linkOccurences(). */
+	bool m_deferOccurences;
+
+	/** The clauses created since #deferOccurences(), in order. */
+	std::vector<std::shared_ptr<Clause>> m_unlinkedClauses;
+
 	ClauseBuilder m_builder;
+
+	/** The objects notified of the changes of the formula. */
+	std::vector<std::reference_wrapper<FormulaListener>> m_listeners;
 };
 
 } // namespace sat
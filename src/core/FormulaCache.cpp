@@ -0,0 +1,245 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "FormulaCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Clause.h"
+#include "Literal.h"
+#include "MappedFile.h"
+#include "RawLiteral.h"
+#include "Variable.h"
+#include "log.h"
+
+
+namespace sat {
+
+namespace {
+
+/** The first bytes of a cache file. */
+constexpr char MAGIC[8] = { 'S', 'A', 'T', 'C', 'A', 'C', 'H', 'E' };
+
+/**
+ * The header of a cache file, in the byte order of the machine that wrote it.
+ * The offsets of the clauses follow, then their literals.
+ */
+struct Header {
+	char          magic[8];
+	std::uint32_t version;
+	std::uint32_t variables;
+	std::uint64_t sourceSize;
+	std::int64_t  sourceModification;
+	std::uint32_t clauses;
+	std::uint32_t reserved;
+	std::uint64_t literals;
+	std::uint64_t checksum;
+};
+
+static_assert(sizeof(Header) % alignof(std::uint64_t) == 0);
+
+
+/**
+ * Gives the size and the modification time of the CNF file.
+ *
+ * @return false if the file cannot be found
+ */
+bool identify(const std::string& p_filename, std::uint64_t& p_size, std::int64_t& p_modification) {
+	struct stat status;
+	if (::stat(p_filename.c_str(), &status) != 0 || !S_ISREG(status.st_mode))
+		return false;
+
+	p_size = status.st_size;
+	p_modification = static_cast<std::int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+	return true;
+}
+
+
+/**
+ * Adds 32-bit words to a FNV-1a checksum.
+ */
+template <typename Word>
+std::uint64_t checksum(std::uint64_t p_checksum, const Word* p_words, std::size_t p_count) {
+	auto bytes = reinterpret_cast<const unsigned char*>(p_words);
+	auto count = p_count * sizeof(Word) / sizeof(std::uint32_t);
+	for (std::size_t i = 0; i < count; ++i) {
+		std::uint32_t word;
+		std::memcpy(&word, bytes + i * sizeof(word), sizeof(word));
+		p_checksum = (p_checksum ^ word) * 0x100000001b3;
+	}
+	return p_checksum;
+}
+
+/** The initial value of the checksum. */
+constexpr std::uint64_t CHECKSUM_BASIS = 0xcbf29ce484222325;
+
+} // anonymous namespace
+
+
+// CONSTRUCTORS
+/**
+ * Creates the cache of a CNF file.
+ *
+ * @param p_sourceFilename
+ *            the name of the CNF file
+ */
+FormulaCache::FormulaCache(const char* p_sourceFilename) :
+m_sourceFilename(p_sourceFilename),
+m_filename(m_sourceFilename + SUFFIX) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the cache file.
+ */
+const std::string& FormulaCache::filename() const {
+	return m_filename;
+}
+
+
+/**
+ * Loads the formula from the cache, if it matches the CNF file.
+ * Everything is checked before the first clause is created, so that a
+ * damaged cache leaves the formula untouched.
+ *
+ * @param p_formula
+ *            the formula to initialize, left empty on failure
+ *
+ * @return true if the formula was loaded
+ */
+bool FormulaCache::load(Formula& p_formula) const {
+	std::uint64_t sourceSize;
+	std::int64_t sourceModification;
+	if (!identify(m_sourceFilename, sourceSize, sourceModification))
+		return false;
+
+	MappedFile file(m_filename.c_str(), sizeof(Header));
+	if (!file.isOpen())
+		return false;
+
+	Header header;
+	std::memcpy(&header, file.begin(), sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+		log_warn(log_cnf, "Ignoring cache file '%s' of an unknown format.", m_filename.c_str());
+		return false;
+	}
+	if (header.sourceSize != sourceSize || header.sourceModification != sourceModification) {
+		log_info(log_cnf, "Ignoring cache file '%s', older than '%s'.", m_filename.c_str(), m_sourceFilename.c_str());
+		return false;
+	}
+
+	auto rows = file.size() - sizeof(Header);
+	if (rows / sizeof(std::uint64_t) <= header.clauses
+			|| (rows - (header.clauses + 1ul) * sizeof(std::uint64_t)) / sizeof(std::int32_t) != header.literals
+			|| (rows - (header.clauses + 1ul) * sizeof(std::uint64_t)) % sizeof(std::int32_t) != 0) {
+		log_warn(log_cnf, "Ignoring truncated cache file '%s'.", m_filename.c_str());
+		return false;
+	}
+
+	auto offsets = reinterpret_cast<const std::uint64_t*>(file.begin() + sizeof(Header));
+	auto literals = reinterpret_cast<const std::int32_t*>(offsets + header.clauses + 1);
+	auto sum = checksum(checksum(CHECKSUM_BASIS, offsets, header.clauses + 1ul), literals, header.literals);
+	bool consistent = sum == header.checksum && offsets[0] == 0 && offsets[header.clauses] == header.literals;
+	for (std::uint32_t clause = 0; consistent && clause < header.clauses; ++clause)
+		consistent = offsets[clause] <= offsets[clause + 1];
+	for (std::uint64_t literal = 0; consistent && literal < header.literals; ++literal)
+		consistent = literals[literal] != 0 && static_cast<std::uint32_t>(std::abs(literals[literal])) <= header.variables;
+	if (!consistent) {
+		log_warn(log_cnf, "Ignoring damaged cache file '%s'.", m_filename.c_str());
+		return false;
+	}
+
+	p_formula.deferOccurences();
+	p_formula.reserve(header.variables, header.clauses);
+	std::vector<RawLiteral> clause;
+	for (std::uint32_t row = 0; row < header.clauses; ++row) {
+		clause.clear();
+		for (auto literal = offsets[row]; literal < offsets[row + 1]; ++literal)
+			clause.emplace_back(literals[literal]);
+		p_formula.createClause(row + 1, clause);
+	}
+	p_formula.linkOccurences();
+
+	log_info(log_cnf, "Problem loaded from cache file '%s'.", m_filename.c_str());
+	return true;
+}
+
+
+/**
+ * Writes the cache of a formula just loaded from the CNF file.
+ * The clauses are written by increasing id. The file is written under a
+ * temporary name then renamed, so that a concurrent run never maps a
+ * partial cache.
+ *
+ * @param p_formula
+ *            the formula
+ *
+ * @return true if the cache was written
+ */
+bool FormulaCache::write(Formula& p_formula) const {
+	Header header {};
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	if (!identify(m_sourceFilename, header.sourceSize, header.sourceModification))
+		return false;
+
+	for (auto variable = p_formula.beginVariable(); variable != p_formula.endVariable(); ++variable)
+		header.variables = std::max<std::uint32_t>(header.variables, (*variable)->id());
+
+	std::vector<std::shared_ptr<Clause>> clauses(p_formula.beginClause(), p_formula.endClause());
+	std::sort(clauses.begin(), clauses.end(), [](const auto& first, const auto& second) {
+		return first->id() < second->id();
+	});
+
+	std::vector<std::uint64_t> offsets;
+	offsets.reserve(clauses.size() + 1);
+	offsets.push_back(0);
+	std::vector<std::int32_t> literals;
+	for (const auto& clause : clauses) {
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			literals.push_back(literal->sign() * static_cast<std::int32_t>(literal->id()));
+		offsets.push_back(literals.size());
+	}
+
+	header.clauses = clauses.size();
+	header.literals = literals.size();
+	header.checksum = checksum(checksum(CHECKSUM_BASIS, offsets.data(), offsets.size()), literals.data(), literals.size());
+
+	auto temporary = m_filename + ".tmp." + std::to_string(::getpid());
+	std::ofstream file(temporary, std::ios::binary);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint64_t));
+	file.write(reinterpret_cast<const char*>(literals.data()), literals.size() * sizeof(std::int32_t));
+	file.close();
+	if (file.fail() || std::rename(temporary.c_str(), m_filename.c_str()) != 0) {
+		std::remove(temporary.c_str());
+		log_warn(log_cnf, "Could not write cache file '%s'.", m_filename.c_str());
+		return false;
+	}
+
+	log_info(log_cnf, "Problem written to cache file '%s'.", m_filename.c_str());
+	return true;
+}
+
+} // namespace sat
@@ -0,0 +1,88 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef FORMULA_CACHE_H
+#define FORMULA_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include "Formula.h"
+
+
+namespace sat {
+
+/**
+ * @brief A binary copy of a loaded formula, kept next to its CNF file.
+ * The clauses are stored in compressed sparse rows: the offsets of the
+ * clauses, then their literals, all of fixed width. The file is mapped
+ * in memory and its clauses created without any parsing.
+ *
+ * The cache records the size and the modification time of the CNF file it
+ * was made from, and a checksum of its rows: a cache that does not match
+ * its CNF file any more, or is damaged, is ignored.
+ */
+class FormulaCache {
+public:
+	/** The suffix added to the name of the CNF file. */
+	static constexpr const char* SUFFIX = ".cache";
+
+	/** The version of the format, changed with the layout. */
+	static constexpr std::uint32_t VERSION = 1;
+
+	/**
+	 * Creates the cache of a CNF file.
+	 *
+	 * @param p_sourceFilename
+	 *            the name of the CNF file
+	 */
+	explicit FormulaCache(const char* p_sourceFilename);
+
+	/**
+	 * Gives the name of the cache file.
+	 */
+	const std::string& filename() const;
+
+	/**
+	 * Loads the formula from the cache, if it matches the CNF file.
+	 *
+	 * @param p_formula
+	 *            the formula to initialize, left empty on failure
+	 *
+	 * @return true if the formula was loaded
+	 */
+	bool load(Formula& p_formula) const;
+
+	/**
+	 * Writes the cache of a formula just loaded from the CNF file.
+	 *
+	 * @param p_formula
+	 *            the formula
+	 *
+	 * @return true if the cache was written
+	 */
+	bool write(Formula& p_formula) const;
+
+private:
+	/** The name of the CNF file. */
+	std::string m_sourceFilename;
+
+	/** The name of the cache file. */
+	std::string m_filename;
+};
+
+} // namespace sat
+
+#endif // FORMULA_CACHE_H
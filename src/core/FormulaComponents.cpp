@@ -0,0 +1,222 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "FormulaComponents.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "RawLiteral.h"
+#include "Valuation.h"
+#include "log.h"
+
+
+namespace sat {
+
+
+// CONSTRUCTORS
+/**
+ * Finds the components of a formula.
+ * The variables of each clause are joined, then the clauses are grouped
+ * by the root of their first variable. The components are ordered by
+ * decreasing number of clauses.
+ *
+ * @param p_formula
+ *            the formula to split
+ */
+FormulaComponents::FormulaComponents(Formula& p_formula) {
+	// Index the variables by id
+	for (auto it = p_formula.beginVariable(); it != p_formula.endVariable(); ++it) {
+		auto id = (*it)->id();
+		if (id >= m_variables.size())
+			m_variables.resize(id + 1);
+		m_variables[id] = *it;
+	}
+	m_parents.resize(m_variables.size());
+	std::iota(m_parents.begin(), m_parents.end(), 0);
+	m_sizes.assign(m_variables.size(), 1);
+
+	// Join the variables of each clause
+	for (auto it = p_formula.beginClause(); it != p_formula.endClause(); ++it) {
+		if ((*it)->size() == 0)
+			continue;
+		auto first = (*it)->firstLiteral().id();
+		for (auto literal = (*it)->beginLiteral(); literal != (*it)->endLiteral(); ++literal)
+			join(first, literal->id());
+	}
+
+	// Group the clauses by root, the empty clauses make a component of their own
+	std::unordered_map<Id, unsigned int> indexes;
+	for (auto it = p_formula.beginClause(); it != p_formula.endClause(); ++it) {
+		auto root = (*it)->size() == 0 ? std::numeric_limits<Id>::max() : find((*it)->firstLiteral().id());
+		auto [index, added] = indexes.emplace(root, m_components.size());
+		if (added)
+			m_components.emplace_back();
+		m_components[index->second].push_back(*it);
+	}
+	std::stable_sort(m_components.begin(), m_components.end(), [](const auto& first, const auto& second) {
+		return first.size() > second.size();
+	});
+
+	log_info(log_formula, "%zu independent components found.", m_components.size());
+}
+
+
+// METHODS
+/**
+ * Gives the number of components.
+ */
+unsigned int FormulaComponents::count() const {
+	return m_components.size();
+}
+
+
+/**
+ * Gives the number of clauses of a component.
+ *
+ * @param p_index
+ *            the index of the component, below #count()
+ */
+unsigned int FormulaComponents::countClauses(unsigned int p_index) const {
+	return m_components[p_index].size();
+}
+
+
+/**
+ * Builds a component as a formula of its own.
+ * The clauses keep their id, and the variables their id.
+ * Each call builds a new formula, so that components can be built concurrently.
+ *
+ * @param p_index
+ *            the index of the component, below #count()
+ *
+ * @return the new formula
+ */
+std::unique_ptr<Formula> FormulaComponents::build(unsigned int p_index) const {
+	auto formula = std::make_unique<Formula>();
+	formula->deferOccurences();
+	std::vector<RawLiteral> literals;
+	for (const auto& clause : m_components[p_index]) {
+		literals.clear();
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			literals.emplace_back(literal->sign() * static_cast<int>(literal->id()));
+		formula->createClause(clause->id(), literals);
+	}
+	formula->linkOccurences();
+	return formula;
+}
+
+
+/**
+ * Moves the valuation of a component onto the variables of the formula.
+ * The literals found by the solver only hold weak references to the variables
+ * of the component, they are replaced by literals on the variables of the
+ * formula with the same ids.
+ * It must be called while the formula built for the component still exists.
+ *
+ * @param p_valuation
+ *            the valuation found for a formula built by #build(unsigned int)
+ *
+ * @return the same valuation, on the variables of the formula
+ */
+solver::Valuation FormulaComponents::restore(solver::Valuation& p_valuation) const {
+	solver::Valuation valuation;
+	if (p_valuation.isUnsatisfiable()) {
+		valuation.setUnsatisfiable();
+		return valuation;
+	}
+
+	for (const auto& literal : p_valuation.getLiterals())
+		valuation.push(Literal(m_variables[literal.id()], literal.sign()));
+	return valuation;
+}
+
+
+/**
+ * Merges the models of the components into a model of the formula.
+ * The variables of the formula that occur in no clause are set false.
+ *
+ * @param p_valuations
+ *            the restored valuation of each component, by index
+ *
+ * @return an unsatisfiable valuation if one of the components is unsatisfiable,
+ *         otherwise a valuation of the variables of the formula
+ */
+solver::Valuation FormulaComponents::merge(std::vector<solver::Valuation>& p_valuations) const {
+	solver::Valuation valuation;
+	if (std::any_of(p_valuations.cbegin(), p_valuations.cend(), [](const solver::Valuation& component) { return component.isUnsatisfiable(); })) {
+		valuation.setUnsatisfiable();
+		return valuation;
+	}
+
+	std::vector<bool> assigned(m_variables.size(), false);
+	for (auto& component : p_valuations) {
+		for (const auto& literal : component.getLiterals()) {
+			valuation.push(literal);
+			assigned[literal.id()] = true;
+		}
+	}
+	for (Id id = 0; id < m_variables.size(); ++id) {
+		if (m_variables[id] && !assigned[id])
+			valuation.push(Literal(m_variables[id], SIGN_NEGATIVE));
+	}
+	return valuation;
+}
+
+
+/**
+ * Gives the root of the set of a variable.
+ * The path is halved on the way up.
+ *
+ * @param p_variableId
+ *            the id of the variable
+ */
+Id FormulaComponents::find(Id p_variableId) {
+	while (m_parents[p_variableId] != p_variableId) {
+		m_parents[p_variableId] = m_parents[m_parents[p_variableId]];
+		p_variableId = m_parents[p_variableId];
+	}
+	return p_variableId;
+}
+
+
+/**
+ * Merges the sets of two variables.
+ * The smaller set is put under the root of the bigger one.
+ *
+ * @param p_first
+ *            the id of the first variable
+ * @param p_second
+ *            the id of the second variable
+ */
+void FormulaComponents::join(Id p_first, Id p_second) {
+	auto first  = find(p_first);
+	auto second = find(p_second);
+	if (first == second)
+		return;
+
+	if (m_sizes[first] < m_sizes[second])
+		std::swap(first, second);
+	m_parents[second] = first;
+	m_sizes[first] += m_sizes[second];
+}
+
+} // namespace sat
@@ -0,0 +1,139 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef FORMULA_COMPONENTS_H
+#define FORMULA_COMPONENTS_H
+
+#include <memory>
+#include <vector>
+#include "FormulaObject.h"
+
+
+namespace sat {
+
+class Formula;
+class Clause;
+class Variable;
+
+namespace solver {
+class Valuation;
+}
+
+
+/**
+ * @brief The independent parts of a formula.
+ *
+ * Two variables are in the same component when they appear in the same
+ * clause, directly or through other variables. The components are found
+ * with a union-find over the variable ids, in a single pass over the clauses.
+ *
+ * As the components share no variable, each one can be solved on its own:
+ * the formula is satisfiable if and only if all of them are, and a model of
+ * the formula is the union of the models of the components.
+ */
+class FormulaComponents {
+public:
+	/**
+	 * Finds the components of a formula.
+	 *
+	 * @param p_formula
+	 *            the formula to split
+	 */
+	explicit FormulaComponents(Formula& p_formula);
+
+	/**
+	 * Gives the number of components.
+	 */
+	unsigned int count() const;
+
+	/**
+	 * Gives the number of clauses of a component.
+	 *
+	 * @param p_index
+	 *            the index of the component, below #count()
+	 */
+	unsigned int countClauses(unsigned int p_index) const;
+
+	/**
+	 * Builds a component as a formula of its own.
+	 * The clauses keep their id, and the variables their id.
+	 * Each call builds a new formula, so that components can be built concurrently.
+	 *
+	 * @param p_index
+	 *            the index of the component, below #count()
+	 *
+	 * @return the new formula
+	 */
+	std::unique_ptr<Formula> build(unsigned int p_index) const;
+
+	/**
+	 * Moves the valuation of a component onto the variables of the formula.
+	 * It must be called while the formula built for the component still exists.
+	 *
+	 * @param p_valuation
+	 *            the valuation found for a formula built by #build(unsigned int)
+	 *
+	 * @return the same valuation, on the variables of the formula
+	 */
+	solver::Valuation restore(solver::Valuation& p_valuation) const;
+
+	/**
+	 * Merges the models of the components into a model of the formula.
+	 * The variables of the formula that occur in no clause are set false.
+	 *
+	 * @param p_valuations
+	 *            the restored valuation of each component, by index
+	 *
+	 * @return an unsatisfiable valuation if one of the components is unsatisfiable,
+	 *         otherwise a valuation of the variables of the formula
+	 */
+	solver::Valuation merge(std::vector<solver::Valuation>& p_valuations) const;
+
+private:
+	/**
+	 * Gives the root of the set of a variable.
+	 *
+	 * @param p_variableId
+	 *            the id of the variable
+	 */
+	Id find(Id p_variableId);
+
+	/**
+	 * Merges the sets of two variables.
+	 *
+	 * @param p_first
+	 *            the id of the first variable
+	 * @param p_second
+	 *            the id of the second variable
+	 */
+	void join(Id p_first, Id p_second);
+
+	/** The parent of each variable in the union-find, by variable id. */
+	std::vector<Id> m_parents;
+
+	/** The number of variables under each root of the union-find, by variable id. */
+	std::vector<unsigned int> m_sizes;
+
+	/** The variables of the formula, by id. */
+	std::vector<std::shared_ptr<Variable>> m_variables;
+
+	/** The clauses of each component. */
+	std::vector<std::vector<std::shared_ptr<Clause>>> m_components;
+};
+
+} // namespace sat
+
+#endif // FORMULA_COMPONENTS_H
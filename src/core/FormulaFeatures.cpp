@@ -0,0 +1,162 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "FormulaFeatures.h"
+
+#include <algorithm>
+#include <cmath>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "log.h"
+
+
+namespace sat {
+
+/**
+ * Gives a ratio, or zero if the denominator is zero.
+ */
+static double ratio(double p_numerator, double p_denominator) {
+	if (p_denominator == 0)
+		return 0;
+	return p_numerator / p_denominator;
+}
+
+
+// CONSTRUCTORS
+/**
+ * Computes the features of a formula.
+ * Each clause and each variable is visited once.
+ *
+ * @param p_formula
+ *            the formula to analyze
+ */
+FormulaFeatures::FormulaFeatures(Formula& p_formula) :
+m_variables(p_formula.countVariables()),
+m_clauses(p_formula.countClauses()),
+m_literals(0),
+m_hornClauses(0),
+m_positiveLiterals(0),
+m_maximumOccurences(0),
+m_occurencesDeviation(0),
+m_clauseSizes() {
+	// Clauses
+	for (auto it = p_formula.beginClause(); it != p_formula.endClause(); ++it) {
+		auto positives = 0u;
+		for (auto literal = (*it)->beginLiteral(); literal != (*it)->endLiteral(); ++literal)
+			if (literal->isPositive())
+				positives++;
+
+		auto size = (*it)->size();
+		m_clauseSizes[std::min(size, HISTOGRAM_SIZE)]++;
+		m_literals += size;
+		m_positiveLiterals += positives;
+		if (positives <= 1)
+			m_hornClauses++;
+	}
+
+	// Variables
+	auto meanOccurences = ratio(m_literals, m_variables);
+	auto squares = 0.0;
+	for (auto it = p_formula.beginVariable(); it != p_formula.endVariable(); ++it) {
+		auto occurences = (*it)->countOccurences();
+		m_maximumOccurences = std::max(m_maximumOccurences, occurences);
+		squares += (occurences - meanOccurences) * (occurences - meanOccurences);
+	}
+	m_occurencesDeviation = std::sqrt(ratio(squares, m_variables));
+
+	log_info(log_formula, "Features computed for %u clauses and %u variables.", m_clauses, m_variables);
+}
+
+
+// METHODS
+/**
+ * Gives the value of a feature by its name.
+ *
+ * @param p_name
+ *            the name of the feature
+ *
+ * @return the value of the feature,
+ *         or nothing if there is no such feature
+ */
+std::optional<double> FormulaFeatures::value(const std::string& p_name) const {
+	auto meanOccurences = ratio(m_literals, m_variables);
+
+	if (p_name == "variables")            return m_variables;
+	if (p_name == "clauses")              return m_clauses;
+	if (p_name == "literals")             return m_literals;
+	if (p_name == "clauseVariableRatio")  return ratio(m_clauses, m_variables);
+	if (p_name == "meanClauseSize")       return ratio(m_literals, m_clauses);
+	if (p_name == "unitClauseRatio")      return ratio(m_clauseSizes[1], m_clauses);
+	if (p_name == "binaryClauseRatio")    return ratio(m_clauseSizes[2], m_clauses);
+	if (p_name == "ternaryClauseRatio")   return ratio(m_clauseSizes[3], m_clauses);
+	if (p_name == "hornClauseRatio")      return ratio(m_hornClauses, m_clauses);
+	if (p_name == "positiveLiteralRatio") return ratio(m_positiveLiterals, m_literals);
+	if (p_name == "occurenceSkew")        return ratio(m_maximumOccurences, meanOccurences);
+	if (p_name == "occurenceDeviation")   return ratio(m_occurencesDeviation, meanOccurences);
+
+	return {};
+}
+
+
+/**
+ * Tells whether a name is the name of a feature.
+ *
+ * @param p_name
+ *            the name to check
+ *
+ * @return true if #value(const std::string&) knows that name
+ */
+bool FormulaFeatures::isFeature(const std::string& p_name) {
+	static const std::array<std::string, 12> names = {
+		"variables", "clauses", "literals", "clauseVariableRatio", "meanClauseSize",
+		"unitClauseRatio", "binaryClauseRatio", "ternaryClauseRatio", "hornClauseRatio",
+		"positiveLiteralRatio", "occurenceSkew", "occurenceDeviation"
+	};
+	return std::find(names.cbegin(), names.cend(), p_name) != names.cend();
+}
+
+
+/**
+ * Gives the number of clauses of a given size.
+ *
+ * @param p_size
+ *            the size of the clauses, the last bucket counts all the bigger clauses
+ */
+unsigned int FormulaFeatures::countClausesOfSize(unsigned int p_size) const {
+	return m_clauseSizes[std::min(p_size, HISTOGRAM_SIZE)];
+}
+
+
+/**
+ * Prints the features to the given stream.
+ */
+std::ostream& operator<<(std::ostream& p_outStream, const FormulaFeatures& p_features) {
+	p_outStream << "Features [ " <<
+			p_features.m_variables << " variables  |  " <<
+			p_features.m_clauses   << " clauses  |  "   <<
+			"ratio "  << *p_features.value("clauseVariableRatio") << "  |  " <<
+			"binary " << *p_features.value("binaryClauseRatio")   << "  |  " <<
+			"horn "   << *p_features.value("hornClauseRatio")     << "  |  " <<
+			"skew "   << *p_features.value("occurenceSkew")       << "  |  sizes";
+	for (auto size = 1u; size <= FormulaFeatures::HISTOGRAM_SIZE; size++)
+		p_outStream << " " << p_features.m_clauseSizes[size];
+	p_outStream << " ]";
+	return p_outStream;
+}
+
+} // namespace sat
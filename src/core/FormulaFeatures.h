@@ -0,0 +1,111 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef FORMULA_FEATURES_H
+#define FORMULA_FEATURES_H
+
+#include <array>
+#include <optional>
+#include <ostream>
+#include <string>
+
+
+namespace sat {
+
+class Formula;
+
+
+/**
+ * @brief Structural features of a formula.
+ * They are computed in a single pass over the clauses and the variables,
+ * and are used to select a solving strategy for a given instance.
+ */
+class FormulaFeatures {
+public:
+	/** The clause sizes are counted individually up to this size, bigger clauses share the last bucket. */
+	static constexpr unsigned int HISTOGRAM_SIZE = 8;
+
+	/**
+	 * Computes the features of a formula.
+	 *
+	 * @param p_formula
+	 *            the formula to analyze
+	 */
+	explicit FormulaFeatures(Formula& p_formula);
+
+	/**
+	 * Gives the value of a feature by its name.
+	 *
+	 * @param p_name
+	 *            the name of the feature
+	 *
+	 * @return the value of the feature,
+	 *         or nothing if there is no such feature
+	 */
+	std::optional<double> value(const std::string& p_name) const;
+
+	/**
+	 * Tells whether a name is the name of a feature.
+	 *
+	 * @param p_name
+	 *            the name to check
+	 *
+	 * @return true if #value(const std::string&) knows that name
+	 */
+	static bool isFeature(const std::string& p_name);
+
+	/**
+	 * Gives the number of clauses of a given size.
+	 *
+	 * @param p_size
+	 *            the size of the clauses, the last bucket counts all the bigger clauses
+	 */
+	unsigned int countClausesOfSize(unsigned int p_size) const;
+
+	/**
+	 * Prints the features to the given stream.
+	 */
+	friend std::ostream& operator<<(std::ostream& p_outStream, const FormulaFeatures& p_features);
+
+private:
+	/** The number of variables. */
+	unsigned int m_variables;
+
+	/** The number of clauses. */
+	unsigned int m_clauses;
+
+	/** The number of literal occurences. */
+	unsigned int m_literals;
+
+	/** The number of clauses with at most one positive literal. */
+	unsigned int m_hornClauses;
+
+	/** The number of positive literal occurences. */
+	unsigned int m_positiveLiterals;
+
+	/** The biggest number of occurences of a variable. */
+	unsigned int m_maximumOccurences;
+
+	/** The standard deviation of the number of occurences per variable. */
+	double m_occurencesDeviation;
+
+	/** The number of clauses per size. */
+	std::array<unsigned int, HISTOGRAM_SIZE + 1> m_clauseSizes;
+};
+
+} // namespace sat
+
+#endif // FORMULA_FEATURES_H
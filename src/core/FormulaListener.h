@@ -0,0 +1,105 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef FORMULA_LISTENER_H
+#define FORMULA_LISTENER_H
+
+#include <memory>
+
+
+namespace sat {
+
+class Clause;
+class Literal;
+class Variable;
+
+
+/**
+ * Interface for the objects that follow the changes of a formula.
+ * They receive every reduction of the formula and every undo of a reduction,
+ * so that they can maintain their own index instead of scanning the formula.
+ */
+class FormulaListener {
+public:
+	/**
+	 * Virtual destructor.
+	 */
+	virtual ~FormulaListener() {};
+
+
+	/**
+	 * Called when a variable has been removed from the formula,
+	 * either because it has been assigned or because it does not occur anymore.
+	 *
+	 * @param p_variable
+	 *            the removed variable
+	 */
+	virtual void onVariableRemoved(const std::shared_ptr<Variable>& p_variable) = 0;
+
+
+	/**
+	 * Called when a removed variable is back in the formula.
+	 *
+	 * @param p_variable
+	 *            the restored variable
+	 */
+	virtual void onVariableRestored(const std::shared_ptr<Variable>& p_variable) = 0;
+
+
+	/**
+	 * Called when a clause has been removed from the formula.
+	 * The clause still holds its literals.
+	 *
+	 * @param p_clause
+	 *            the removed clause
+	 */
+	virtual void onClauseRemoved(const std::shared_ptr<Clause>& p_clause) = 0;
+
+
+	/**
+	 * Called when a clause is back in the formula.
+	 *
+	 * @param p_clause
+	 *            the restored clause
+	 */
+	virtual void onClauseRestored(const std::shared_ptr<Clause>& p_clause) = 0;
+
+
+	/**
+	 * Called when a literal has been removed from a clause.
+	 *
+	 * @param p_clause
+	 *            the shrunk clause
+	 * @param p_literal
+	 *            the removed literal
+	 */
+	virtual void onClauseShrunk(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) = 0;
+
+
+	/**
+	 * Called when a literal is back in a clause.
+	 *
+	 * @param p_clause
+	 *            the grown clause
+	 * @param p_literal
+	 *            the restored literal
+	 */
+	virtual void onClauseGrown(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) = 0;
+};
+
+} // namespace sat
+
+#endif // FORMULA_LISTENER_H
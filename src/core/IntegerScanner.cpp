@@ -0,0 +1,299 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "IntegerScanner.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "utils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SAT_X86_KERNELS
+#endif
+
+
+namespace sat {
+
+namespace {
+
+/**
+ * @brief The classes of the characters of a block, one bit per character.
+ */
+struct BlockMasks {
+	/** The spaces, tabulations, carriage returns and line breaks. */
+	std::uint64_t separators;
+
+	/** The decimal digits. */
+	std::uint64_t digits;
+
+	/** The minus signs. */
+	std::uint64_t minus;
+};
+
+
+/**
+ * Tells whether a character ends an integer.
+ */
+inline bool isSeparator(char p_character) {
+	return p_character == ' ' || p_character == '\t' || p_character == '\r' || p_character == '\n';
+}
+
+
+#ifdef SAT_X86_KERNELS
+/**
+ * Classifies the characters of a block 16 at a time.
+ */
+__attribute__((target("sse2")))
+BlockMasks classifySse2(const char* p_block) {
+	const auto zero = _mm_set1_epi8('0');
+	const auto nine = _mm_set1_epi8(9);
+	const auto space = _mm_set1_epi8(' ');
+	const auto tabulation = _mm_set1_epi8('\t');
+	const auto carriageReturn = _mm_set1_epi8('\r');
+	const auto lineBreak = _mm_set1_epi8('\n');
+	const auto minus = _mm_set1_epi8('-');
+
+	BlockMasks masks { 0, 0, 0 };
+	for (std::size_t index = 0; index < IntegerScanner::BLOCK_SIZE; index += 16) {
+		auto characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_block + index));
+		auto offsets = _mm_sub_epi8(characters, zero);
+		auto digits = _mm_cmpeq_epi8(_mm_min_epu8(offsets, nine), offsets);
+		auto separators = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(characters, space), _mm_cmpeq_epi8(characters, tabulation)),
+				_mm_or_si128(_mm_cmpeq_epi8(characters, carriageReturn), _mm_cmpeq_epi8(characters, lineBreak)));
+		masks.separators |= std::uint64_t(static_cast<std::uint16_t>(_mm_movemask_epi8(separators))) << index;
+		masks.digits |= std::uint64_t(static_cast<std::uint16_t>(_mm_movemask_epi8(digits))) << index;
+		masks.minus |= std::uint64_t(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(characters, minus)))) << index;
+	}
+	return masks;
+}
+
+
+/**
+ * Classifies the characters of a block 32 at a time.
+ */
+__attribute__((target("avx2")))
+BlockMasks classifyAvx2(const char* p_block) {
+	const auto zero = _mm256_set1_epi8('0');
+	const auto nine = _mm256_set1_epi8(9);
+	const auto space = _mm256_set1_epi8(' ');
+	const auto tabulation = _mm256_set1_epi8('\t');
+	const auto carriageReturn = _mm256_set1_epi8('\r');
+	const auto lineBreak = _mm256_set1_epi8('\n');
+	const auto minus = _mm256_set1_epi8('-');
+
+	BlockMasks masks { 0, 0, 0 };
+	for (std::size_t index = 0; index < IntegerScanner::BLOCK_SIZE; index += 32) {
+		auto characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_block + index));
+		auto offsets = _mm256_sub_epi8(characters, zero);
+		auto digits = _mm256_cmpeq_epi8(_mm256_min_epu8(offsets, nine), offsets);
+		auto separators = _mm256_or_si256(
+				_mm256_or_si256(_mm256_cmpeq_epi8(characters, space), _mm256_cmpeq_epi8(characters, tabulation)),
+				_mm256_or_si256(_mm256_cmpeq_epi8(characters, carriageReturn), _mm256_cmpeq_epi8(characters, lineBreak)));
+		masks.separators |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(separators))) << index;
+		masks.digits |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(digits))) << index;
+		masks.minus |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(characters, minus)))) << index;
+	}
+	return masks;
+}
+#endif
+
+
+/**
+ * Converts 8 digits at once.
+ *
+ * @param p_digits
+ *            the values of 8 digits, the most significant in the low byte
+ */
+inline std::uint64_t convertEightDigits(std::uint64_t p_digits) {
+	p_digits = (p_digits * 10) + (p_digits >> 8);
+	p_digits = (((p_digits & 0x000000FF000000FF) * (100 + (1000000ULL << 32)))
+			+ (((p_digits >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+	return static_cast<std::uint32_t>(p_digits);
+}
+
+
+/**
+ * Reads an integer token: an optional minus sign, digits, then a separator.
+ * Up to 8 digits are recognized and converted together in a 64-bit word,
+ * the next ones one by one.
+ *
+ * @param p_token
+ *            the first character of the token, followed by at least 16 readable characters
+ * @param p_end
+ *            the end of the readable characters
+ * @param p_value
+ *            receives the integer
+ *
+ * @return the character after the integer,
+ *         or nullptr if the token is not a valid int or does not end
+ *         before p_end
+ */
+inline const char* readToken(const char* p_token, const char* p_end, int& p_value) {
+	auto negative = (*p_token == '-');
+	auto digits = p_token + negative;
+
+	std::size_t length = 0;
+	std::uint64_t value = 0;
+	if constexpr (std::endian::native == std::endian::little) {
+		std::uint64_t word;
+		std::memcpy(&word, digits, sizeof(word));
+		auto offsets = word ^ 0x3030303030303030;
+		auto nonDigits = (((offsets & 0x7F7F7F7F7F7F7F7F) + 0x7676767676767676) | offsets) & 0x8080808080808080;
+		length = nonDigits == 0 ? 8 : std::countr_zero(nonDigits) / 8;
+		if (length > 0)
+			value = convertEightDigits(offsets << (8 * (8 - length)));
+	}
+	// Leading zeros never overflow, the end bounds them
+	for (; digits + length < p_end && digits[length] >= '0' && digits[length] <= '9'; ++length) {
+		value = value * 10 + (digits[length] - '0');
+		if (value > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+			return nullptr;
+	}
+	if (length == 0 || digits + length >= p_end || !isSeparator(digits[length]))
+		return nullptr;
+
+	p_value = negative ? -static_cast<int>(value) : static_cast<int>(value);
+	return digits + length;
+}
+
+
+/**
+ * Reads the integers at the start of some characters, block by block.
+ * The tokens start at the digits and minus signs that do not follow another
+ * one. A token may end in the next block, whose characters are then not
+ * taken as the start of a token.
+ */
+template<BlockMasks (*classify)(const char*)>
+std::size_t scanBlocks(const char* p_begin, const char* p_end, int* p_values, std::size_t p_capacity, std::size_t& p_count) {
+	std::size_t count = 0;
+	auto position = p_begin;
+	std::uint64_t carry = 0;
+	for (auto block = p_begin; p_end - block >= static_cast<std::ptrdiff_t>(IntegerScanner::BLOCK_SIZE + IntegerScanner::PADDING) && count + IntegerScanner::BLOCK_VALUES <= p_capacity; block += IntegerScanner::BLOCK_SIZE) {
+		auto masks = classify(block);
+		auto tokens = masks.digits | masks.minus;
+		auto others = ~(tokens | masks.separators);
+		auto starts = tokens & ~((tokens << 1) | carry);
+		carry = tokens >> 63;
+		if (others != 0)
+			starts &= (std::uint64_t(1) << std::countr_zero(others)) - 1;
+
+		for (; starts != 0; starts &= starts - 1) {
+			int value;
+			auto after = readToken(block + std::countr_zero(starts), p_end, value);
+			if (isNull(after)) {
+				p_count = count;
+				return position - p_begin;
+			}
+			p_values[count++] = value;
+			position = after;
+		}
+		if (others != 0)
+			break;
+	}
+	p_count = count;
+	return position - p_begin;
+}
+
+
+/** A block scanning function. */
+using ScanFunction = std::size_t (*)(const char*, const char*, int*, std::size_t, std::size_t&);
+
+
+/**
+ * @brief The block scanning function that suits the processor.
+ */
+struct Kernel {
+	/** The function, null when the characters are better read one by one. */
+	ScanFunction scan;
+
+	/** The name of the instructions it uses. */
+	const char* instructions;
+
+	Kernel() :
+	scan(nullptr),
+	instructions("scalar") {
+#ifdef SAT_X86_KERNELS
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			scan = scanBlocks<classifyAvx2>;
+			instructions = "avx2";
+		}
+		else if (__builtin_cpu_supports("sse2")) {
+			scan = scanBlocks<classifySse2>;
+			instructions = "sse2";
+		}
+#endif
+	}
+};
+
+
+/**
+ * Gives the block scanning function that suits the processor, chosen on the first call.
+ */
+const Kernel& kernel() {
+	static const Kernel instance;
+	return instance;
+}
+
+} // anonymous namespace
+
+
+// METHODS
+/**
+ * Reads the integers at the start of some characters.
+ * The scan stops before the first character that is neither a digit, a
+ * minus sign nor whitespace, before the first token that is not a valid
+ * int, or when the characters or the values run out. The last 80
+ * characters are never read. Without vector instructions nothing is read:
+ * classifying the characters one by one is slower than parsing them.
+ *
+ * @param p_begin
+ *            the first character, at the start of a token or whitespace
+ * @param p_end
+ *            the end of the characters
+ * @param p_values
+ *            receives the integers read
+ * @param p_capacity
+ *            the number of integers p_values can hold
+ * @param p_count
+ *            receives the number of integers read
+ *
+ * @return the number of characters read, up to the end of the last integer
+ */
+std::size_t IntegerScanner::scan(const char* p_begin, const char* p_end, int* p_values, std::size_t p_capacity, std::size_t& p_count) {
+	const auto& selected = kernel();
+	if (isNull(selected.scan)) {
+		p_count = 0;
+		return 0;
+	}
+	return selected.scan(p_begin, p_end, p_values, p_capacity, p_count);
+}
+
+
+/**
+ * Gives the name of the instructions used to classify the characters.
+ *
+ * @return "avx2", "sse2" or "scalar"
+ */
+const char* IntegerScanner::instructions() {
+	return kernel().instructions;
+}
+
+} // namespace sat
@@ -0,0 +1,75 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef INTEGER_SCANNER_H
+#define INTEGER_SCANNER_H
+
+#include <cstddef>
+
+
+namespace sat {
+
+/**
+ * @brief Reads runs of signed integers separated by whitespace, in bulk.
+ * The characters are classified 64 at a time, with AVX2 or SSE2 when the
+ * processor has them, and the digits of each integer are converted
+ * together in a 64-bit word. Without these instructions, nothing is read
+ * and the characters are left to a character by character parser.
+ */
+class IntegerScanner {
+public:
+	/** The number of characters classified at once. */
+	static constexpr std::size_t BLOCK_SIZE = 64;
+
+	/** The number of characters that must follow a block, so that an integer started in it can be read. */
+	static constexpr std::size_t PADDING = 16;
+
+	/** The room needed in the values to scan a block. */
+	static constexpr std::size_t BLOCK_VALUES = BLOCK_SIZE / 2;
+
+	/**
+	 * Reads the integers at the start of some characters.
+	 * The scan stops before the first character that is neither a digit, a
+	 * minus sign nor whitespace, before the first token that is not a
+	 * valid int, or when the characters or the values run out; the rest
+	 * is left to a character by character parser.
+	 *
+	 * @param p_begin
+	 *            the first character, at the start of a token or whitespace
+	 * @param p_end
+	 *            the end of the characters
+	 * @param p_values
+	 *            receives the integers read
+	 * @param p_capacity
+	 *            the number of integers p_values can hold
+	 * @param p_count
+	 *            receives the number of integers read
+	 *
+	 * @return the number of characters read, up to the end of the last integer
+	 */
+	static std::size_t scan(const char* p_begin, const char* p_end, int* p_values, std::size_t p_capacity, std::size_t& p_count);
+
+	/**
+	 * Gives the name of the instructions used to classify the characters.
+	 *
+	 * @return "avx2", "sse2" or "scalar"
+	 */
+	static const char* instructions();
+};
+
+} // namespace sat
+
+#endif // INTEGER_SCANNER_H
@@ -28,6 +28,11 @@ namespace solver {
 
 class LiteralSelector {
 public:
+	/**
+	 * Virtual destructor.
+	 */
+	virtual ~LiteralSelector() {};
+
 	virtual Literal getLiteral(Formula& p_formula) = 0;
 };
 
@@ -0,0 +1,99 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "utils.h"
+
+
+namespace sat {
+
+// CONSTRUCTORS
+/**
+ * Maps a file, if it is a regular file big enough.
+ * The pages are read ahead, as the file is read as a whole.
+ *
+ * @param p_filename
+ *            the name of the file to map
+ * @param p_minimumSize
+ *            the size under which the file is not mapped
+ */
+MappedFile::MappedFile(const char* p_filename, std::size_t p_minimumSize) :
+m_data(nullptr),
+m_size(0) {
+	auto descriptor = ::open(p_filename, O_RDONLY);
+	if (descriptor < 0)
+		return;
+
+	struct stat status;
+	if (::fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) && static_cast<std::size_t>(status.st_size) >= p_minimumSize && status.st_size > 0) {
+		auto data = ::mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (data != MAP_FAILED) {
+			::madvise(data, status.st_size, MADV_WILLNEED);
+			m_data = static_cast<const char*>(data);
+			m_size = status.st_size;
+		}
+	}
+	::close(descriptor);
+}
+
+
+/**
+ * Unmaps the file.
+ */
+MappedFile::~MappedFile() {
+	if (notNull(m_data))
+		::munmap(const_cast<char*>(m_data), m_size);
+}
+
+
+// METHODS
+/**
+ * Tells whether the file is mapped.
+ */
+bool MappedFile::isOpen() const {
+	return notNull(m_data);
+}
+
+
+/**
+ * Gives the number of bytes of the file.
+ */
+std::size_t MappedFile::size() const {
+	return m_size;
+}
+
+
+/**
+ * Gives the first byte of the file.
+ */
+const char* MappedFile::begin() const {
+	return m_data;
+}
+
+
+/**
+ * Gives the end of the file.
+ */
+const char* MappedFile::end() const {
+	return m_data + m_size;
+}
+
+} // namespace sat
@@ -0,0 +1,78 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+
+
+namespace sat {
+
+/**
+ * @brief A regular file mapped read-only in memory, unmapped on destruction.
+ */
+class MappedFile {
+public:
+	/**
+	 * Maps a file, if it is a regular file big enough.
+	 *
+	 * @param p_filename
+	 *            the name of the file to map
+	 * @param p_minimumSize
+	 *            the size under which the file is not mapped
+	 */
+	MappedFile(const char* p_filename, std::size_t p_minimumSize);
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/**
+	 * Unmaps the file.
+	 */
+	~MappedFile();
+
+	/**
+	 * Tells whether the file is mapped.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Gives the number of bytes of the file.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Gives the first byte of the file.
+	 */
+	const char* begin() const;
+
+	/**
+	 * Gives the end of the file.
+	 */
+	const char* end() const;
+
+private:
+	/** The mapped bytes. */
+	const char* m_data;
+
+	/** The number of mapped bytes. */
+	std::size_t m_size;
+};
+
+} // namespace sat
+
+#endif // MAPPED_FILE_H
@@ -30,6 +30,11 @@ namespace solver {
 
 class PolaritySelector {
 public:
+	/**
+	 * Virtual destructor.
+	 */
+	virtual ~PolaritySelector() {};
+
 	virtual Literal getLiteral(const std::shared_ptr<Variable>& p_variable) = 0;
 };
 
@@ -0,0 +1,98 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STATIC_LISTENER_LIST_H
+#define STATIC_LISTENER_LIST_H
+
+#include <tuple>
+
+
+namespace sat {
+
+class Literal;
+class Clause;
+
+namespace solver {
+namespace listeners {
+
+
+/**
+ * @brief Compile-time counterpart of ListenerDispatcher.
+ *
+ * The list of listeners is fixed by the template parameters, and each event
+ * calls the listeners by their exact type, without virtual dispatch, so that
+ * the compiler can inline them in the solver. An empty list costs nothing.
+ *
+ * @tparam Listeners
+ *            the types of the listeners, all different
+ */
+template<class... Listeners>
+class StaticListenerList {
+public:
+	/**
+	 * Gathers the listeners.
+	 *
+	 * @param p_listeners
+	 *            the listeners, in notification order
+	 */
+	explicit StaticListenerList(Listeners&... p_listeners) :
+	m_listeners(p_listeners...) {
+	}
+
+	void init() {
+		(std::get<Listeners&>(m_listeners).Listeners::init(), ...);
+	}
+
+	void onDecide([[maybe_unused]] Literal& p_literal) {
+		(std::get<Listeners&>(m_listeners).Listeners::onDecide(p_literal), ...);
+	}
+
+	void onPropagate([[maybe_unused]] Literal& p_literal) {
+		(std::get<Listeners&>(m_listeners).Listeners::onPropagate(p_literal), ...);
+	}
+
+	void onAssert([[maybe_unused]] Literal& p_literal) {
+		(std::get<Listeners&>(m_listeners).Listeners::onAssert(p_literal), ...);
+	}
+
+	void onConflict([[maybe_unused]] Clause& p_clause) {
+		(std::get<Listeners&>(m_listeners).Listeners::onConflict(p_clause), ...);
+	}
+
+	void onBacktrack([[maybe_unused]] Literal& p_literal) {
+		(std::get<Listeners&>(m_listeners).Listeners::onBacktrack(p_literal), ...);
+	}
+
+	void cleanup() {
+		(std::get<Listeners&>(m_listeners).Listeners::cleanup(), ...);
+	}
+
+private:
+	/** The listeners. */
+	std::tuple<Listeners&...> m_listeners;
+};
+
+
+/**
+ * A listener list without any listener.
+ */
+using NoListener = StaticListenerList<>;
+
+} // namespace sat::solver::listeners
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STATIC_LISTENER_LIST_H
@@ -0,0 +1,71 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STATIC_LITERAL_SELECTOR_H
+#define STATIC_LITERAL_SELECTOR_H
+
+#include "Formula.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "log.h"
+#include "utils.h"
+
+
+namespace sat {
+namespace solver {
+
+
+/**
+ * @brief Compile-time counterpart of VariablePolarityLiteralSelector.
+ *
+ * The selectors are called by their exact type, without virtual dispatch,
+ * so that the compiler can inline them in the solver.
+ *
+ * @tparam VariableSelectorType
+ *            the type of the variable selector
+ * @tparam PolaritySelectorType
+ *            the type of the polarity selector
+ */
+template<class VariableSelectorType, class PolaritySelectorType>
+class StaticLiteralSelector {
+public:
+	StaticLiteralSelector(VariableSelectorType& p_variableSelector, PolaritySelectorType& p_polaritySelector) :
+	m_variableSelector(p_variableSelector),
+	m_polaritySelector(p_polaritySelector) {
+	}
+
+	Literal getLiteral(Formula& p_formula) {
+		auto variable = m_variableSelector.VariableSelectorType::getVariable(p_formula);
+
+		// No variable found : return a literal pointing to no variable
+		if (isNull(variable)) {
+			log_error(log_dpll, "There is no more literal in the formula.");
+			return Literal();
+		}
+
+		// Variable found : select the polarity of the literal
+		return m_polaritySelector.PolaritySelectorType::getLiteral(variable);
+	}
+
+private:
+	VariableSelectorType& m_variableSelector;
+	PolaritySelectorType& m_polaritySelector;
+};
+
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STATIC_LITERAL_SELECTOR_H
@@ -17,6 +17,7 @@
 #include "Variable.h"
 
 #include <algorithm>
+#include <iterator>
 #include "Clause.h"
 #include "utils.h"
 #include "log.h"
@@ -34,7 +35,40 @@ FormulaObject(p_id) {
 }
 
 
+/**
+ * Creates an empty list of occurences, in the vector.
+ */
+Variable::Occurences::Occurences() :
+m_slice(nullptr),
+m_size(0),
+m_capacity(0) {
+}
+
+
 // METHODS
+/**
+ * Moves the occurences to a slice of a pool.
+ *
+ * @param p_pool
+ *            the pool, shared by the variables of the formula
+ * @param p_offset
+ *            the start of the slice of this variable in the pool
+ * @param p_positives
+ *            the number of positive occurences to make room for, besides
+ *            the current ones
+ * @param p_negatives
+ *            the number of negative occurences to make room for, besides
+ *            the current ones
+ */
+void Variable::reserveOccurences(const std::shared_ptr<std::shared_ptr<Clause>[]>& p_pool, std::size_t p_offset, unsigned int p_positives, unsigned int p_negatives) {
+	auto slice = m_positiveOccurences.moveTo(p_pool.get() + p_offset, m_positiveOccurences.size() + p_positives);
+	m_negativeOccurences.moveTo(slice, m_negativeOccurences.size() + p_negatives);
+
+	// The previous pool may only be released once the occurences are moved
+	m_pool = p_pool;
+}
+
+
 void Variable::addOccurence(const std::shared_ptr<Clause>& p_clause, int p_sign) {
 	// Parameters check
 	if (isNull(p_clause)) {
@@ -44,12 +78,12 @@ void Variable::addOccurence(const std::shared_ptr<Clause>& p_clause, int p_sign)
 	
 	switch (p_sign) {
 		case SIGN_POSITIVE:
-			m_positiveOccurences.emplace_back(p_clause);
+			m_positiveOccurences.add(p_clause);
 			log_debug(log_formula, "Clause %u added to positive occurences of variable x%u.", p_clause->id(), id());
 			break;
 		
 		case SIGN_NEGATIVE:
-			m_negativeOccurences.emplace_back(p_clause);
+			m_negativeOccurences.add(p_clause);
 			log_debug(log_formula, "Clause %u added to negative occurences of variable x%u.", p_clause->id(), id());
 			break;
 		
@@ -98,14 +132,14 @@ std::shared_ptr<Clause> Variable::occurence(int p_sign) const {
 }
 
 
-std::vector<std::shared_ptr<Clause>>::iterator Variable::beginOccurence(int p_sign) {
+std::shared_ptr<Clause>* Variable::beginOccurence(int p_sign) {
 	if (p_sign == SIGN_POSITIVE)
 		return m_positiveOccurences.begin();
 	return m_negativeOccurences.begin();
 }
 
 
-std::vector<std::shared_ptr<Clause>>::iterator Variable::endOccurence(int p_sign) {
+std::shared_ptr<Clause>* Variable::endOccurence(int p_sign) {
 	if (p_sign == SIGN_POSITIVE)
 		return m_positiveOccurences.end();
 	return m_negativeOccurences.end();
@@ -113,12 +147,109 @@ std::vector<std::shared_ptr<Clause>>::iterator Variable::endOccurence(int p_sign
 
 
 void Variable::removePositiveOccurence(const std::shared_ptr<Clause>& p_clause) {
-	std::erase(m_positiveOccurences, p_clause);
+	m_positiveOccurences.remove(p_clause);
 }
 
 
 void Variable::removeNegativeOccurence(const std::shared_ptr<Clause>& p_clause) {
-	std::erase(m_negativeOccurences, p_clause);
+	m_negativeOccurences.remove(p_clause);
+}
+
+
+/**
+ * Adds an occurence at the end of the list.
+ * A full slice is moved to the vector first.
+ *
+ * @param p_clause
+ *            the clause
+ */
+void Variable::Occurences::add(const std::shared_ptr<Clause>& p_clause) {
+	if (notNull(m_slice)) {
+		if (m_size < m_capacity) {
+			m_slice[m_size++] = p_clause;
+			return;
+		}
+
+		m_overflow.reserve(2 * m_size);
+		std::move(m_slice, m_slice + m_size, std::back_inserter(m_overflow));
+		m_slice = nullptr;
+		m_size = 0;
+		m_capacity = 0;
+	}
+	m_overflow.push_back(p_clause);
+}
+
+
+/**
+ * Removes all the occurences of a clause.
+ * The next occurences are shifted, so the order is kept.
+ *
+ * @param p_clause
+ *            the clause
+ */
+void Variable::Occurences::remove(const std::shared_ptr<Clause>& p_clause) {
+	if (isNull(m_slice)) {
+		std::erase(m_overflow, p_clause);
+		return;
+	}
+
+	auto last = std::remove(m_slice, m_slice + m_size, p_clause);
+	std::for_each(last, m_slice + m_size, [](auto& p_removed) { p_removed.reset(); });
+	m_size = last - m_slice;
+}
+
+
+/**
+ * Moves the occurences to a slice.
+ * A list without a slice keeps using its vector.
+ *
+ * @param p_slice
+ *            the start of the slice
+ * @param p_capacity
+ *            the size of the slice, at least the number of occurences
+ *
+ * @return the end of the slice
+ */
+std::shared_ptr<Clause>* Variable::Occurences::moveTo(std::shared_ptr<Clause>* p_slice, unsigned int p_capacity) {
+	if (p_capacity == 0) {
+		m_slice = nullptr;
+		m_size = 0;
+		m_capacity = 0;
+		return p_slice;
+	}
+
+	auto occurences = size();
+	std::move(begin(), end(), p_slice);
+	m_size = occurences;
+	m_slice = p_slice;
+	m_capacity = p_capacity;
+	std::vector<std::shared_ptr<Clause>>().swap(m_overflow);
+	return p_slice + p_capacity;
+}
+
+
+bool Variable::Occurences::empty() const {
+	return size() == 0;
+}
+
+
+unsigned int Variable::Occurences::size() const {
+	return notNull(m_slice) ? m_size : m_overflow.size();
+}
+
+
+const std::shared_ptr<Clause>& Variable::Occurences::front() const {
+	return notNull(m_slice) ? m_slice[0] : m_overflow.front();
+}
+
+
+std::shared_ptr<Clause>* Variable::Occurences::begin() {
+	return notNull(m_slice) ? m_slice : m_overflow.data();
+}
+
+
+std::shared_ptr<Clause>* Variable::Occurences::end() {
+	return begin() + size();
 }
 
 } // namespace sat
@@ -17,6 +17,7 @@
 #ifndef VARIABLE_H
 #define VARIABLE_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include "FormulaObject.h"
@@ -31,13 +32,22 @@ class Clause;
 
 
 /**
- * 
+ * @brief A variable and the clauses it occurs in, by sign.
+ *
+ * The occurences of a sign are stored in a slice of a pool shared by the
+ * variables of a formula, built in one piece by Formula#linkOccurences().
+ * Removing an occurence leaves room in the slice, and adding one fills that
+ * room. When the slice is full, or for a variable that was never given one,
+ * the occurences move to a vector of the variable, which grows as needed.
+ * Either way, the occurences of a sign are contiguous and stay in the order
+ * they were added.
  */
 class Variable : public FormulaObject {
 public:
 	explicit Variable(Id p_id);
 
 	void addOccurence(const std::shared_ptr<Clause>& p_clauseId, int p_sign);
+	void reserveOccurences(const std::shared_ptr<std::shared_ptr<Clause>[]>& p_pool, std::size_t p_offset, unsigned int p_positives, unsigned int p_negatives);
 
 	bool hasPositiveOccurence() const;
 	bool hasNegativeOccurence() const;
@@ -47,15 +57,50 @@ public:
 	unsigned int countOccurences() const;
 
 	std::shared_ptr<Clause> occurence(int p_sign) const;
-	std::vector<std::shared_ptr<Clause>>::iterator beginOccurence(int p_sign);
-	std::vector<std::shared_ptr<Clause>>::iterator endOccurence(int p_sign);
+	std::shared_ptr<Clause>* beginOccurence(int p_sign);
+	std::shared_ptr<Clause>* endOccurence(int p_sign);
 
 	void removePositiveOccurence(const std::shared_ptr<Clause>& p_clause);
 	void removeNegativeOccurence(const std::shared_ptr<Clause>& p_clause);
 
 private:
-	std::vector<std::shared_ptr<Clause>> m_positiveOccurences;
-	std::vector<std::shared_ptr<Clause>> m_negativeOccurences;
+	/**
+	 * @brief The occurences of a sign, in a slice of the pool or in a
+	 * vector of their own.
+	 */
+	class Occurences {
+	public:
+		Occurences();
+
+		void add(const std::shared_ptr<Clause>& p_clause);
+		void remove(const std::shared_ptr<Clause>& p_clause);
+		std::shared_ptr<Clause>* moveTo(std::shared_ptr<Clause>* p_slice, unsigned int p_capacity);
+
+		bool empty() const;
+		unsigned int size() const;
+		const std::shared_ptr<Clause>& front() const;
+		std::shared_ptr<Clause>* begin();
+		std::shared_ptr<Clause>* end();
+
+	private:
+		/** The slice of the pool, or nullptr when the vector is used. */
+		std::shared_ptr<Clause>* m_slice;
+
+		/** The number of occurences in the slice. */
+		unsigned int m_size;
+
+		/** The size of the slice. */
+		unsigned int m_capacity;
+
+		/** The occurences that do not fit in a slice. */
+		std::vector<std::shared_ptr<Clause>> m_overflow;
+	};
+
+	/** The pool holding the slices, kept alive as long as the variable. */
+	std::shared_ptr<std::shared_ptr<Clause>[]> m_pool;
+
+	Occurences m_positiveOccurences;
+	Occurences m_negativeOccurences;
 };
 
 } // namespace sat
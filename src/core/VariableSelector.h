@@ -30,6 +30,11 @@ namespace solver {
 
 class VariableSelector {
 public:
+	/**
+	 * Virtual destructor.
+	 */
+	virtual ~VariableSelector() {};
+
 	/**
 	 * Note: Switch to C++14 type option<Variable> when available
 	 * 
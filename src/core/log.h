@@ -22,6 +22,7 @@
 #define LOG_CATEGORY_FORMULA    "sat.formula"
 #define LOG_CATEGORY_HISTORY    "sat.history"
 #define LOG_CATEGORY_VALUATION  "sat.valuation"
+#define LOG_CATEGORY_PREPROCESSING "sat.preprocessing"
 #define LOG_SUDOKU              "sudoku"
 
 
@@ -32,6 +33,7 @@
 #define log_formula
 #define log_history
 #define log_valuation
+#define log_preprocessing
 #define log_sudoku
 
 #define log_setup()              false
@@ -54,6 +56,7 @@
 #define log_formula              log4c_category_get(LOG_CATEGORY_FORMULA)
 #define log_history              log4c_category_get(LOG_CATEGORY_HISTORY)
 #define log_valuation            log4c_category_get(LOG_CATEGORY_VALUATION)
+#define log_preprocessing        log4c_category_get(LOG_CATEGORY_PREPROCESSING)
 #define log_sudoku               log4c_category_get(LOG_SUDOKU)
 
 #define log_setup()              log4c_init()
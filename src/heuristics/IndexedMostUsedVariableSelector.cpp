@@ -0,0 +1,268 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "IndexedMostUsedVariableSelector.h"
+
+#include <algorithm>
+#include "Formula.h"
+#include "Clause.h"
+#include "Literal.h"
+#include "Variable.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Registers the selector as a listener of the formula.
+ *
+ * @param p_formula
+ *            the formula to follow
+ */
+IndexedMostUsedVariableSelector::IndexedMostUsedVariableSelector(Formula& p_formula) :
+m_formula(p_formula),
+m_built(false) {
+	m_formula.addListener(*this);
+}
+
+
+/**
+ * Unregisters the selector from the formula.
+ */
+IndexedMostUsedVariableSelector::~IndexedMostUsedVariableSelector() {
+	m_formula.removeListener(*this);
+}
+
+
+// METHODS
+/**
+ * Gives the variable at the top of the heap.
+ * The heap is built from the variables of the formula on the first call.
+ *
+ * @return a pointer to the variable found,
+ *         or nullptr if there is no variable in the formula
+ */
+std::shared_ptr<Variable> IndexedMostUsedVariableSelector::getVariable(Formula& p_formula) {
+	if (!m_built) {
+		m_heap.assign(p_formula.beginVariable(), p_formula.endVariable());
+		for (const auto& variable : m_heap) {
+			auto id = variable->id();
+			if (id >= m_positions.size()) {
+				m_positions.resize(id + 1, NOT_IN_HEAP);
+				m_occurences.resize(id + 1, 0);
+			}
+			m_occurences[id] = variable->countOccurences();
+		}
+		std::sort(m_heap.begin(), m_heap.end(), [this](const std::shared_ptr<Variable>& first, const std::shared_ptr<Variable>& second) {
+			return before(*first, *second);
+		});
+
+		// A sorted array is a heap
+		for (unsigned int index = 0; index < m_heap.size(); ++index)
+			m_positions[m_heap[index]->id()] = index;
+		m_built = true;
+	}
+
+	if (m_heap.empty())
+		return nullptr;
+
+	return m_heap.front();
+}
+
+
+// FORMULA LISTENER
+/**
+ * Removes the variable from the heap.
+ */
+void IndexedMostUsedVariableSelector::onVariableRemoved(const std::shared_ptr<Variable>& p_variable) {
+	erase(p_variable->id());
+}
+
+
+/**
+ * Puts the variable back into the heap.
+ */
+void IndexedMostUsedVariableSelector::onVariableRestored(const std::shared_ptr<Variable>& p_variable) {
+	insert(p_variable);
+}
+
+
+/**
+ * Moves down the variables of the clause, they have lost an occurence.
+ */
+void IndexedMostUsedVariableSelector::onClauseRemoved(const std::shared_ptr<Clause>& p_clause) {
+	updateClause(*p_clause);
+}
+
+
+/**
+ * Moves up the variables of the clause, they have gained an occurence.
+ */
+void IndexedMostUsedVariableSelector::onClauseRestored(const std::shared_ptr<Clause>& p_clause) {
+	updateClause(*p_clause);
+}
+
+
+/**
+ * Moves down the variable of the removed literal.
+ */
+void IndexedMostUsedVariableSelector::onClauseShrunk(const std::shared_ptr<Clause>&, const Literal& p_literal) {
+	update(p_literal.id());
+}
+
+
+/**
+ * Moves up the variable of the restored literal.
+ */
+void IndexedMostUsedVariableSelector::onClauseGrown(const std::shared_ptr<Clause>&, const Literal& p_literal) {
+	update(p_literal.id());
+}
+
+
+// HEAP
+/**
+ * Tells whether a variable must be selected before another one:
+ * the most used first, then the smallest id.
+ * The numbers of occurences are the ones recorded in the heap.
+ */
+bool IndexedMostUsedVariableSelector::before(const Variable& p_first, const Variable& p_second) const {
+	auto firstUse = m_occurences[p_first.id()];
+	auto secondUse = m_occurences[p_second.id()];
+	return firstUse > secondUse || (firstUse == secondUse && p_first.id() < p_second.id());
+}
+
+
+/**
+ * Tells whether a variable is in the heap.
+ */
+bool IndexedMostUsedVariableSelector::contains(Id p_variableId) const {
+	return p_variableId < m_positions.size() && m_positions[p_variableId] != NOT_IN_HEAP;
+}
+
+
+/**
+ * Adds a variable to the heap, if not already there.
+ */
+void IndexedMostUsedVariableSelector::insert(const std::shared_ptr<Variable>& p_variable) {
+	auto id = p_variable->id();
+	if (!m_built || contains(id))
+		return;
+
+	if (id >= m_positions.size()) {
+		m_positions.resize(id + 1, NOT_IN_HEAP);
+		m_occurences.resize(id + 1, 0);
+	}
+
+	m_occurences[id] = p_variable->countOccurences();
+	m_heap.push_back(p_variable);
+	m_positions[id] = m_heap.size() - 1;
+	siftUp(m_heap.size() - 1);
+}
+
+
+/**
+ * Removes a variable from the heap, if there.
+ */
+void IndexedMostUsedVariableSelector::erase(Id p_variableId) {
+	if (!m_built || !contains(p_variableId))
+		return;
+
+	auto index = m_positions[p_variableId];
+	m_positions[p_variableId] = NOT_IN_HEAP;
+
+	// Fill the hole with the last variable
+	auto last = std::move(m_heap.back());
+	m_heap.pop_back();
+	if (index < m_heap.size()) {
+		auto lastId = last->id();
+		place(index, std::move(last));
+		update(lastId);
+	}
+}
+
+
+/**
+ * Records the number of occurences of a variable after a change,
+ * and moves the variable to its place.
+ */
+void IndexedMostUsedVariableSelector::update(Id p_variableId) {
+	if (!m_built || !contains(p_variableId))
+		return;
+
+	auto index = m_positions[p_variableId];
+	m_occurences[p_variableId] = m_heap[index]->countOccurences();
+	siftUp(index);
+	siftDown(m_positions[p_variableId]);
+}
+
+
+/**
+ * Updates all the variables of a clause.
+ */
+void IndexedMostUsedVariableSelector::updateClause(const Clause& p_clause) {
+	for (auto literal = p_clause.beginLiteral(); literal != p_clause.endLiteral(); ++literal)
+		update(literal->id());
+}
+
+
+/**
+ * Moves the variable at the given index towards the top of the heap.
+ */
+void IndexedMostUsedVariableSelector::siftUp(unsigned int p_index) {
+	auto variable = std::move(m_heap[p_index]);
+	while (p_index > 0) {
+		auto parent = (p_index - 1) / 2;
+		if (!before(*variable, *m_heap[parent]))
+			break;
+		place(p_index, std::move(m_heap[parent]));
+		p_index = parent;
+	}
+	place(p_index, std::move(variable));
+}
+
+
+/**
+ * Moves the variable at the given index towards the bottom of the heap.
+ */
+void IndexedMostUsedVariableSelector::siftDown(unsigned int p_index) {
+	auto variable = std::move(m_heap[p_index]);
+	auto size = m_heap.size();
+	for (auto child = 2 * p_index + 1; child < size; child = 2 * p_index + 1) {
+		if (child + 1 < size && before(*m_heap[child + 1], *m_heap[child]))
+			++child;
+		if (!before(*m_heap[child], *variable))
+			break;
+		place(p_index, std::move(m_heap[child]));
+		p_index = child;
+	}
+	place(p_index, std::move(variable));
+}
+
+
+/**
+ * Stores a variable at the given index and records its position.
+ */
+void IndexedMostUsedVariableSelector::place(unsigned int p_index, std::shared_ptr<Variable> p_variable) {
+	m_positions[p_variable->id()] = p_index;
+	m_heap[p_index] = std::move(p_variable);
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
@@ -0,0 +1,119 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef INDEXED_MOST_USED_VARIABLE_SELECTOR_H
+#define INDEXED_MOST_USED_VARIABLE_SELECTOR_H
+
+#include <vector>
+#include "VariableSelector.h"
+#include "FormulaListener.h"
+#include "FormulaObject.h"
+
+
+namespace sat {
+
+class Formula;
+class Variable;
+
+namespace solver {
+namespace selectors {
+
+
+/**
+ * @brief Selects the most used variable, like MostUsedVariableSelector, without scanning the formula.
+ *
+ * The variables are kept in a binary heap ordered by number of occurences,
+ * the smallest id first on ties. The heap is built on the first selection,
+ * then it follows the reductions and the restorations of the formula,
+ * so that each change costs a logarithmic time in the number of variables.
+ *
+ * The heap compares the numbers of occurences recorded when the variables
+ * were last placed, not the current ones: the formula changes the counts
+ * of all the variables of a clause before it notifies the selector, and
+ * the heap must stay ordered until each of them is placed again.
+ */
+class IndexedMostUsedVariableSelector : public VariableSelector, public FormulaListener {
+public:
+	/**
+	 * Registers the selector as a listener of the formula.
+	 *
+	 * @param p_formula
+	 *            the formula to follow
+	 */
+	explicit IndexedMostUsedVariableSelector(Formula& p_formula);
+
+	/**
+	 * Unregisters the selector from the formula.
+	 */
+	~IndexedMostUsedVariableSelector();
+
+	/**
+	 * Gives the variable at the top of the heap.
+	 *
+	 * @return a pointer to the variable found,
+	 *         or nullptr if there is no variable in the formula
+	 */
+	std::shared_ptr<Variable> getVariable(Formula& p_formula) override;
+
+	void onVariableRemoved(const std::shared_ptr<Variable>& p_variable) override;
+	void onVariableRestored(const std::shared_ptr<Variable>& p_variable) override;
+	void onClauseRemoved(const std::shared_ptr<Clause>& p_clause) override;
+	void onClauseRestored(const std::shared_ptr<Clause>& p_clause) override;
+	void onClauseShrunk(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) override;
+	void onClauseGrown(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) override;
+
+protected:
+	/**
+	 * Tells whether a variable must be selected before another one,
+	 * from their recorded numbers of occurences.
+	 */
+	bool before(const Variable& p_first, const Variable& p_second) const;
+
+	bool contains(Id p_variableId) const;
+	void insert(const std::shared_ptr<Variable>& p_variable);
+	void erase(Id p_variableId);
+	void update(Id p_variableId);
+	void updateClause(const Clause& p_clause);
+
+	void siftUp(unsigned int p_index);
+	void siftDown(unsigned int p_index);
+	void place(unsigned int p_index, std::shared_ptr<Variable> p_variable);
+
+private:
+	/** The followed formula. */
+	Formula& m_formula;
+
+	/** Whether the heap has been built. */
+	bool m_built;
+
+	/** The heap of the variables of the formula. */
+	std::vector<std::shared_ptr<Variable>> m_heap;
+
+	/** The position in m_heap of each variable, by id, or NOT_IN_HEAP. */
+	std::vector<unsigned int> m_positions;
+
+	/** The number of occurences of each variable when it was last placed, by id. */
+	std::vector<unsigned int> m_occurences;
+
+	/** The position of the variables that are not in the heap. */
+	static constexpr unsigned int NOT_IN_HEAP = static_cast<unsigned int>(-1);
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // INDEXED_MOST_USED_VARIABLE_SELECTOR_H
@@ -19,6 +19,8 @@
 #include <limits>
 #include "Formula.h"
 #include "Variable.h"
+#include "Randomizer.h"
+#include "utils.h"
 
 
 namespace sat {
@@ -26,6 +28,26 @@ namespace solver {
 namespace selectors {
 
 
+// CONSTRUCTORS
+/**
+ * Creates a selector that breaks the ties by smallest id.
+ */
+LeastUsedVariableSelector::LeastUsedVariableSelector() :
+m_tieBreaker(nullptr) {
+}
+
+
+/**
+ * Creates a selector that breaks the ties in a random order.
+ *
+ * @param p_tieBreaker
+ *            the source of the random order
+ */
+LeastUsedVariableSelector::LeastUsedVariableSelector(Randomizer& p_tieBreaker) :
+m_tieBreaker(&p_tieBreaker) {
+}
+
+
 // METHODS
 std::shared_ptr<Variable> LeastUsedVariableSelector::getVariable(Formula& p_formula) {
 	if (!p_formula.hasVariables())
@@ -33,16 +55,30 @@ std::shared_ptr<Variable> LeastUsedVariableSelector::getVariable(Formula& p_form
 	
 	auto minimumUse = std::numeric_limits<unsigned int>::max();
 	auto selectedVar = std::shared_ptr<Variable>();
+	if (notNull(m_tieBreaker))
+		m_tieBreaker->shuffle();
+
 	for (auto it = p_formula.beginVariable(); it != p_formula.endVariable(); ++it) {
-		if ((*it)->countOccurences() < minimumUse) {
+		auto use = (*it)->countOccurences();
+		if (use < minimumUse || (use == minimumUse && notNull(selectedVar) && breaksTie(**it, *selectedVar))) {
 			selectedVar = *it;
-			minimumUse = selectedVar->countOccurences();
+			minimumUse = use;
 		}
 	}
 	
 	return selectedVar;
 }
 
+
+/**
+ * Tells whether a variable is preferred to another one as used as much.
+ */
+bool LeastUsedVariableSelector::breaksTie(const Variable& p_candidate, const Variable& p_selected) const {
+	if (isNull(m_tieBreaker))
+		return p_candidate.id() < p_selected.id();
+	return m_tieBreaker->before(p_candidate.id(), p_selected.id());
+}
+
 } // namespace sat::solver::selectors
 } // namespace sat::solver
 } // namespace sat
@@ -18,6 +18,8 @@
 
 #include "Formula.h"
 #include "Variable.h"
+#include "Randomizer.h"
+#include "utils.h"
 
 
 namespace sat {
@@ -25,6 +27,26 @@ namespace solver {
 namespace selectors {
 
 
+// CONSTRUCTORS
+/**
+ * Creates a selector that breaks the ties by smallest id.
+ */
+MostUsedVariableSelector::MostUsedVariableSelector() :
+m_tieBreaker(nullptr) {
+}
+
+
+/**
+ * Creates a selector that breaks the ties in a random order.
+ *
+ * @param p_tieBreaker
+ *            the source of the random order
+ */
+MostUsedVariableSelector::MostUsedVariableSelector(Randomizer& p_tieBreaker) :
+m_tieBreaker(&p_tieBreaker) {
+}
+
+
 // METHODS
 std::shared_ptr<Variable> MostUsedVariableSelector::getVariable(Formula& p_formula) {
 	if (!p_formula.hasVariables())
@@ -32,16 +54,30 @@ std::shared_ptr<Variable> MostUsedVariableSelector::getVariable(Formula& p_formu
 
 	auto maximumUse = 0u;
 	auto selectedVar = std::shared_ptr<Variable>();
+	if (notNull(m_tieBreaker))
+		m_tieBreaker->shuffle();
+
 	for (auto it = p_formula.beginVariable(); it != p_formula.endVariable(); ++it) {
-		if ((*it)->countOccurences() > maximumUse) {
+		auto use = (*it)->countOccurences();
+		if (use > maximumUse || (use == maximumUse && notNull(selectedVar) && breaksTie(**it, *selectedVar))) {
 			selectedVar = *it;
-			maximumUse = selectedVar->countOccurences();
+			maximumUse = use;
 		}
 	}
 
 	return selectedVar;
 }
 
+
+/**
+ * Tells whether a variable is preferred to another one as used as much.
+ */
+bool MostUsedVariableSelector::breaksTie(const Variable& p_candidate, const Variable& p_selected) const {
+	if (isNull(m_tieBreaker))
+		return p_candidate.id() < p_selected.id();
+	return m_tieBreaker->before(p_candidate.id(), p_selected.id());
+}
+
 } // namespace sat::solver::selectors
 } // namespace sat::solver
 } // namespace sat
@@ -28,13 +28,40 @@ class Variable;
 namespace solver {
 namespace selectors {
 
+class Randomizer;
+
 
 /**
  * Selects the most used variable in the formula's list.
+ * Ties are broken by id, so that the selection does not depend on the
+ * order in which the formula stores its variables.
  */
 class MostUsedVariableSelector : public VariableSelector {
 public:
+	/**
+	 * Creates a selector that breaks the ties by smallest id.
+	 */
+	MostUsedVariableSelector();
+
+	/**
+	 * Creates a selector that breaks the ties in a random order.
+	 *
+	 * @param p_tieBreaker
+	 *            the source of the random order
+	 */
+	explicit MostUsedVariableSelector(Randomizer& p_tieBreaker);
+
 	std::shared_ptr<Variable> getVariable(Formula& p_formula) override;
+
+protected:
+	/**
+	 * Tells whether a variable is preferred to another one as used as much.
+	 */
+	bool breaksTie(const Variable& p_candidate, const Variable& p_selected) const;
+
+private:
+	/** The random order of the ties, or nullptr to prefer the smallest id. */
+	Randomizer* m_tieBreaker;
 };
 
 } // namespace sat::solver::selectors
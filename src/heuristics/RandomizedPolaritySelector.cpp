@@ -0,0 +1,62 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "RandomizedPolaritySelector.h"
+
+#include "Variable.h"
+#include "Literal.h"
+#include "Randomizer.h"
+#include "utils.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Wraps a polarity selector.
+ *
+ * @param p_selector
+ *            the selector used for the other decisions
+ * @param p_randomizer
+ *            the source of randomness
+ * @param p_frequency
+ *            the probability of a random polarity, between 0 and 1
+ */
+RandomizedPolaritySelector::RandomizedPolaritySelector(PolaritySelector& p_selector, Randomizer& p_randomizer, double p_frequency) :
+m_selector(p_selector),
+m_randomizer(p_randomizer),
+m_frequency(p_frequency) {
+}
+
+
+// METHODS
+/**
+ * Selects a random polarity with the configured frequency,
+ * otherwise delegates to the wrapped selector.
+ */
+Literal RandomizedPolaritySelector::getLiteral(const std::shared_ptr<Variable>& p_variable) {
+	if (isNull(p_variable) || !m_randomizer.chance(m_frequency))
+		return m_selector.getLiteral(p_variable);
+
+	return Literal(p_variable, m_randomizer.chance(0.5) ? SIGN_POSITIVE : SIGN_NEGATIVE);
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
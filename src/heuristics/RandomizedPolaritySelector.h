@@ -0,0 +1,72 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef RANDOMIZED_POLARITY_SELECTOR_H
+#define RANDOMIZED_POLARITY_SELECTOR_H
+
+#include "PolaritySelector.h"
+
+
+namespace sat {
+
+class Variable;
+class Literal;
+
+namespace solver {
+namespace selectors {
+
+class Randomizer;
+
+
+/**
+ * @brief Replaces some of the selections of another selector by a random polarity.
+ */
+class RandomizedPolaritySelector : public PolaritySelector {
+public:
+	/**
+	 * Wraps a polarity selector.
+	 *
+	 * @param p_selector
+	 *            the selector used for the other decisions
+	 * @param p_randomizer
+	 *            the source of randomness
+	 * @param p_frequency
+	 *            the probability of a random polarity, between 0 and 1
+	 */
+	RandomizedPolaritySelector(PolaritySelector& p_selector, Randomizer& p_randomizer, double p_frequency);
+
+	/**
+	 * Selects a random polarity with the configured frequency,
+	 * otherwise delegates to the wrapped selector.
+	 */
+	Literal getLiteral(const std::shared_ptr<Variable>& p_variable) override;
+
+private:
+	/** The wrapped selector. */
+	PolaritySelector& m_selector;
+
+	/** The source of randomness. */
+	Randomizer& m_randomizer;
+
+	/** The probability of a random polarity. */
+	double m_frequency;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // RANDOMIZED_POLARITY_SELECTOR_H
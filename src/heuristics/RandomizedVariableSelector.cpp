@@ -0,0 +1,73 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "RandomizedVariableSelector.h"
+
+#include "Formula.h"
+#include "Variable.h"
+#include "Randomizer.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Wraps a variable selector.
+ *
+ * @param p_selector
+ *            the selector used for the other decisions
+ * @param p_randomizer
+ *            the source of randomness
+ * @param p_frequency
+ *            the probability of a random selection, between 0 and 1
+ */
+RandomizedVariableSelector::RandomizedVariableSelector(VariableSelector& p_selector, Randomizer& p_randomizer, double p_frequency) :
+m_selector(p_selector),
+m_randomizer(p_randomizer),
+m_frequency(p_frequency) {
+}
+
+
+// METHODS
+/**
+ * Selects a random variable with the configured frequency,
+ * otherwise delegates to the wrapped selector.
+ * The random variable is the first one in a random order of the ids,
+ * so it does not depend on the order of the formula's list.
+ *
+ * @return a pointer to the variable found,
+ *         or nullptr if there is no variable in the formula
+ */
+std::shared_ptr<Variable> RandomizedVariableSelector::getVariable(Formula& p_formula) {
+	if (!p_formula.hasVariables() || !m_randomizer.chance(m_frequency))
+		return m_selector.getVariable(p_formula);
+
+	m_randomizer.shuffle();
+	auto selectedVar = *p_formula.beginVariable();
+	for (auto it = p_formula.beginVariable(); it != p_formula.endVariable(); ++it) {
+		if (m_randomizer.before((*it)->id(), selectedVar->id()))
+			selectedVar = *it;
+	}
+
+	return selectedVar;
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
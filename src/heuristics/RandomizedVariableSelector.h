@@ -0,0 +1,75 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef RANDOMIZED_VARIABLE_SELECTOR_H
+#define RANDOMIZED_VARIABLE_SELECTOR_H
+
+#include "VariableSelector.h"
+
+
+namespace sat {
+
+class Formula;
+class Variable;
+
+namespace solver {
+namespace selectors {
+
+class Randomizer;
+
+
+/**
+ * @brief Replaces some of the selections of another selector by a random variable.
+ */
+class RandomizedVariableSelector : public VariableSelector {
+public:
+	/**
+	 * Wraps a variable selector.
+	 *
+	 * @param p_selector
+	 *            the selector used for the other decisions
+	 * @param p_randomizer
+	 *            the source of randomness
+	 * @param p_frequency
+	 *            the probability of a random selection, between 0 and 1
+	 */
+	RandomizedVariableSelector(VariableSelector& p_selector, Randomizer& p_randomizer, double p_frequency);
+
+	/**
+	 * Selects a random variable with the configured frequency,
+	 * otherwise delegates to the wrapped selector.
+	 *
+	 * @return a pointer to the variable found,
+	 *         or nullptr if there is no variable in the formula
+	 */
+	std::shared_ptr<Variable> getVariable(Formula& p_formula) override;
+
+private:
+	/** The wrapped selector. */
+	VariableSelector& m_selector;
+
+	/** The source of randomness. */
+	Randomizer& m_randomizer;
+
+	/** The probability of a random selection. */
+	double m_frequency;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // RANDOMIZED_VARIABLE_SELECTOR_H
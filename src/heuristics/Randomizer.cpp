@@ -0,0 +1,88 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "Randomizer.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Creates a randomizer.
+ *
+ * @param p_seed
+ *            the seed of the sequence
+ */
+Randomizer::Randomizer(std::uint64_t p_seed) :
+m_generator(p_seed),
+m_salt(0) {
+}
+
+
+// METHODS
+/**
+ * Draws an event of a given probability.
+ * Nothing is drawn for the probabilities 0 and 1.
+ *
+ * @param p_probability
+ *            the probability of the event, between 0 and 1
+ *
+ * @return true if the event happens
+ */
+bool Randomizer::chance(double p_probability) {
+	if (p_probability <= 0.0)
+		return false;
+	if (p_probability >= 1.0)
+		return true;
+
+	// 53 random bits give a uniform double in [0, 1)
+	return static_cast<double>(m_generator() >> 11) * 0x1.0p-53 < p_probability;
+}
+
+
+/**
+ * Draws a new order of the variable ids for #before(Id, Id).
+ */
+void Randomizer::shuffle() {
+	m_salt = m_generator();
+}
+
+
+/**
+ * Tells whether a variable id comes before another one in the current order.
+ */
+bool Randomizer::before(Id p_first, Id p_second) const {
+	auto first = mix(m_salt ^ p_first);
+	auto second = mix(m_salt ^ p_second);
+	return first < second || (first == second && p_first < p_second);
+}
+
+
+/**
+ * Scrambles the bits of a value, with the finalizer of SplitMix64.
+ */
+std::uint64_t Randomizer::mix(std::uint64_t p_value) {
+	p_value = (p_value ^ (p_value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	p_value = (p_value ^ (p_value >> 27)) * 0x94d049bb133111ebULL;
+	return p_value ^ (p_value >> 31);
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
@@ -0,0 +1,89 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef RANDOMIZER_H
+#define RANDOMIZER_H
+
+#include <cstdint>
+#include <random>
+#include "FormulaObject.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+/**
+ * @brief Seedable source of randomness for the selectors.
+ *
+ * The draws only depend on the seed: they use the raw output of a
+ * 64-bit Mersenne Twister, whose sequence is fixed by the standard,
+ * and not the distributions of the standard library, which are not.
+ *
+ * Besides random draws, it gives a random order of the variable ids
+ * to break the ties between variables regardless of the order in which
+ * the formula stores them.
+ */
+class Randomizer {
+public:
+	/**
+	 * Creates a randomizer.
+	 *
+	 * @param p_seed
+	 *            the seed of the sequence
+	 */
+	explicit Randomizer(std::uint64_t p_seed);
+
+	/**
+	 * Draws an event of a given probability.
+	 *
+	 * @param p_probability
+	 *            the probability of the event, between 0 and 1
+	 *
+	 * @return true if the event happens
+	 */
+	bool chance(double p_probability);
+
+	/**
+	 * Draws a new order of the variable ids for #before(Id, Id).
+	 */
+	void shuffle();
+
+	/**
+	 * Tells whether a variable id comes before another one in the current order.
+	 */
+	bool before(Id p_first, Id p_second) const;
+
+protected:
+	/**
+	 * Scrambles the bits of a value.
+	 */
+	static std::uint64_t mix(std::uint64_t p_value);
+
+private:
+	/** The generator. */
+	std::mt19937_64 m_generator;
+
+	/** The salt of the current order of the ids. */
+	std::uint64_t m_salt;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // RANDOMIZER_H
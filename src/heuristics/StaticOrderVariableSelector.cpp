@@ -0,0 +1,225 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "StaticOrderVariableSelector.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "log.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Computes the branching order of the variables of a formula,
+ * and registers the selector as a listener of the formula.
+ *
+ * @param p_formula
+ *            the formula, as loaded
+ */
+StaticOrderVariableSelector::StaticOrderVariableSelector(Formula& p_formula) :
+m_formula(p_formula),
+m_next(0) {
+	// Number the variables by increasing id, so that the order does not depend on the hash sets
+	std::vector<std::shared_ptr<Variable>> variables(p_formula.beginVariable(), p_formula.endVariable());
+	std::sort(variables.begin(), variables.end(), [](const std::shared_ptr<Variable>& a, const std::shared_ptr<Variable>& b) {
+		return a->id() < b->id();
+	});
+	std::unordered_map<Id, unsigned int> vertices;
+	for (auto vertex = 0u; vertex < variables.size(); vertex++)
+		vertices[variables[vertex]->id()] = vertex;
+
+	// Build the incidence graph
+	std::vector<std::vector<unsigned int>> neighbours(variables.size());
+	for (auto clause = p_formula.beginClause(); clause != p_formula.endClause(); ++clause) {
+		if ((*clause)->size() > CLAUSE_SIZE_LIMIT)
+			continue;
+
+		for (auto first = (*clause)->beginLiteral(); first != (*clause)->endLiteral(); ++first)
+			for (auto second = first + 1; second != (*clause)->endLiteral(); ++second) {
+				auto u = vertices[first->id()];
+				auto v = vertices[second->id()];
+				neighbours[u].emplace_back(v);
+				neighbours[v].emplace_back(u);
+			}
+	}
+	for (auto& adjacency : neighbours) {
+		std::sort(adjacency.begin(), adjacency.end());
+		adjacency.erase(std::unique(adjacency.begin(), adjacency.end()), adjacency.end());
+	}
+
+	// Branch on the last eliminated variables first
+	auto elimination = eliminationOrder(neighbours);
+	if (!variables.empty())
+		m_ranks.resize(variables.back()->id() + 1, NOT_ORDERED);
+	for (auto vertex = elimination.rbegin(); vertex != elimination.rend(); ++vertex) {
+		m_ranks[variables[*vertex]->id()] = m_order.size();
+		m_order.emplace_back(variables[*vertex]);
+	}
+
+	m_formula.addListener(*this);
+	log_info(log_dpll, "Static order computed for %lu variables.", m_order.size());
+}
+
+
+/**
+ * Unregisters the selector from the formula.
+ */
+StaticOrderVariableSelector::~StaticOrderVariableSelector() {
+	m_formula.removeListener(*this);
+}
+
+
+// METHODS
+/**
+ * Gives the first variable of the order that is still in the formula.
+ * The variables before the cursor are assigned, so the search starts there
+ * and moves the cursor past the assigned variables it finds.
+ *
+ * @return a pointer to the variable found,
+ *         or nullptr if there is no variable in the formula
+ */
+std::shared_ptr<Variable> StaticOrderVariableSelector::getVariable(Formula& p_formula) {
+	if (!p_formula.hasVariables())
+		return nullptr;
+
+	while (m_next < m_order.size() && m_order[m_next]->isUnused())
+		++m_next;
+	if (m_next < m_order.size())
+		return m_order[m_next];
+
+	// Variables created after the order was computed
+	return *p_formula.beginVariable();
+}
+
+
+// FORMULA LISTENER
+/**
+ * Does nothing, the cursor skips the assigned variables on the next selection.
+ */
+void StaticOrderVariableSelector::onVariableRemoved(const std::shared_ptr<Variable>&) {
+}
+
+
+/**
+ * Moves the cursor back to the restored variable, if it is before.
+ */
+void StaticOrderVariableSelector::onVariableRestored(const std::shared_ptr<Variable>& p_variable) {
+	auto id = p_variable->id();
+	if (id < m_ranks.size() && m_ranks[id] < m_next)
+		m_next = m_ranks[id];
+}
+
+
+/**
+ * Does nothing, the order does not depend on the clauses.
+ */
+void StaticOrderVariableSelector::onClauseRemoved(const std::shared_ptr<Clause>&) {
+}
+
+
+/**
+ * Does nothing, the order does not depend on the clauses.
+ */
+void StaticOrderVariableSelector::onClauseRestored(const std::shared_ptr<Clause>&) {
+}
+
+
+/**
+ * Does nothing, the order does not depend on the clauses.
+ */
+void StaticOrderVariableSelector::onClauseShrunk(const std::shared_ptr<Clause>&, const Literal&) {
+}
+
+
+/**
+ * Does nothing, the order does not depend on the clauses.
+ */
+void StaticOrderVariableSelector::onClauseGrown(const std::shared_ptr<Clause>&, const Literal&) {
+}
+
+
+/**
+ * Computes a min-degree elimination order of the incidence graph.
+ * Eliminating a vertex connects all its neighbours together (fill-in),
+ * except for the vertices of too high degree where the fill-in would be quadratic.
+ *
+ * @param p_neighbours
+ *            the adjacency lists of the graph, consumed by the elimination
+ *
+ * @return the vertices in elimination order
+ */
+std::vector<unsigned int> StaticOrderVariableSelector::eliminationOrder(std::vector<std::vector<unsigned int>>& p_neighbours) const {
+	std::vector<std::unordered_set<unsigned int>> graph(p_neighbours.size());
+	for (auto vertex = 0u; vertex < p_neighbours.size(); vertex++) {
+		graph[vertex].insert(p_neighbours[vertex].begin(), p_neighbours[vertex].end());
+		p_neighbours[vertex].clear();
+	}
+
+	// Min-heap of (degree, vertex), stale entries are skipped
+	using Entry = std::pair<std::size_t, unsigned int>;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	for (auto vertex = 0u; vertex < graph.size(); vertex++)
+		queue.emplace(graph[vertex].size(), vertex);
+
+	std::vector<bool> eliminated(graph.size(), false);
+	std::vector<unsigned int> order;
+	order.reserve(graph.size());
+	while (!queue.empty()) {
+		auto [degree, vertex] = queue.top();
+		queue.pop();
+		if (eliminated[vertex] || degree != graph[vertex].size())
+			continue;
+
+		eliminated[vertex] = true;
+		order.emplace_back(vertex);
+
+		// Disconnect the vertex
+		std::vector<unsigned int> neighbours(graph[vertex].begin(), graph[vertex].end());
+		std::sort(neighbours.begin(), neighbours.end());
+		for (auto neighbour : neighbours)
+			graph[neighbour].erase(vertex);
+		graph[vertex].clear();
+
+		// Fill-in: its neighbours become a clique
+		if (neighbours.size() <= FILL_IN_LIMIT)
+			for (auto first = neighbours.begin(); first != neighbours.end(); ++first)
+				for (auto second = first + 1; second != neighbours.end(); ++second) {
+					graph[*first].insert(*second);
+					graph[*second].insert(*first);
+				}
+
+		for (auto neighbour : neighbours)
+			queue.emplace(graph[neighbour].size(), neighbour);
+	}
+
+	return order;
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
@@ -0,0 +1,114 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STATIC_ORDER_VARIABLE_SELECTOR_H
+#define STATIC_ORDER_VARIABLE_SELECTOR_H
+
+#include <vector>
+#include "VariableSelector.h"
+#include "FormulaListener.h"
+#include "FormulaObject.h"
+
+
+namespace sat {
+
+class Formula;
+class Variable;
+
+namespace solver {
+namespace selectors {
+
+
+/**
+ * @brief Selects the variables in an order computed once from the structure of the formula.
+ *
+ * The order comes from a min-degree elimination of the variable incidence graph,
+ * where two variables are adjacent when they appear in the same clause.
+ * The variables eliminated last are the ones that connect the most parts of
+ * the formula, so the branching order is the reverse of the elimination order.
+ * A cursor skips the assigned variables of the order, and goes back when the
+ * formula restores a variable on backtrack.
+ */
+class StaticOrderVariableSelector : public VariableSelector, public FormulaListener {
+public:
+	/** Clauses bigger than this do not add edges to the incidence graph. */
+	static constexpr unsigned int CLAUSE_SIZE_LIMIT = 64;
+
+	/** Variables with more neighbours than this are eliminated without fill-in. */
+	static constexpr unsigned int FILL_IN_LIMIT = 32;
+
+	/**
+	 * Computes the branching order of the variables of a formula,
+	 * and registers the selector as a listener of the formula.
+	 *
+	 * @param p_formula
+	 *            the formula, as loaded
+	 */
+	explicit StaticOrderVariableSelector(Formula& p_formula);
+
+	/**
+	 * Unregisters the selector from the formula.
+	 */
+	~StaticOrderVariableSelector();
+
+	/**
+	 * Gives the first variable of the order that is still in the formula.
+	 *
+	 * @return a pointer to the variable found,
+	 *         or nullptr if there is no variable in the formula
+	 */
+	std::shared_ptr<Variable> getVariable(Formula& p_formula) override;
+
+	void onVariableRemoved(const std::shared_ptr<Variable>& p_variable) override;
+	void onVariableRestored(const std::shared_ptr<Variable>& p_variable) override;
+	void onClauseRemoved(const std::shared_ptr<Clause>& p_clause) override;
+	void onClauseRestored(const std::shared_ptr<Clause>& p_clause) override;
+	void onClauseShrunk(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) override;
+	void onClauseGrown(const std::shared_ptr<Clause>& p_clause, const Literal& p_literal) override;
+
+protected:
+	/**
+	 * Computes a min-degree elimination order of the incidence graph.
+	 *
+	 * @param p_neighbours
+	 *            the adjacency lists of the graph, consumed by the elimination
+	 *
+	 * @return the vertices in elimination order
+	 */
+	std::vector<unsigned int> eliminationOrder(std::vector<std::vector<unsigned int>>& p_neighbours) const;
+
+private:
+	/** The followed formula. */
+	Formula& m_formula;
+
+	/** The variables in branching order. */
+	std::vector<std::shared_ptr<Variable>> m_order;
+
+	/** The rank in m_order of each variable, by id, or NOT_ORDERED. */
+	std::vector<unsigned int> m_ranks;
+
+	/** The rank in m_order before which all the variables are assigned. */
+	unsigned int m_next;
+
+	/** The rank of the variables created after the order was computed. */
+	static constexpr unsigned int NOT_ORDERED = static_cast<unsigned int>(-1);
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STATIC_ORDER_VARIABLE_SELECTOR_H
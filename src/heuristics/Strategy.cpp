@@ -0,0 +1,299 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "Strategy.h"
+
+#include <sstream>
+#include "log.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Creates the default strategy: most used variable, most used polarity,
+ * no random decision, ties broken by smallest id, all the simplifications
+ * but blocked clause elimination and symmetry breaking, and independent
+ * components solved separately.
+ */
+Strategy::Strategy() :
+m_variableSelector("mostused"),
+m_polaritySelector("mostused"),
+m_polarityCaching(false),
+m_randomFrequency(0.0),
+m_randomTies(false),
+m_seed(0),
+m_probing(true),
+m_equivalence(true),
+m_subsumption(true),
+m_blockedClauseElimination(false),
+m_variableElimination(true),
+m_symmetryBreaking(false),
+m_preprocessingEffort(1.0),
+m_components(true) {
+}
+
+
+// METHODS
+/**
+ * Changes a setting of the strategy.
+ *
+ * @param p_key
+ *            the name of the setting
+ * @param p_value
+ *            the new value
+ *
+ * @return true if the setting was changed,
+ *         false if the key or the value is unknown
+ */
+bool Strategy::set(const std::string& p_key, const std::string& p_value) {
+	if (p_key == "variable" && (p_value == "first" || p_value == "mostused" || p_value == "leastused" || p_value == "static" || p_value == "indexed")) {
+		m_variableSelector = p_value;
+		return true;
+	}
+
+	if (p_key == "polarity" && (p_value == "positive" || p_value == "mostused" || p_value == "leastused")) {
+		m_polaritySelector = p_value;
+		return true;
+	}
+
+	if (p_key == "caching" && (p_value == "yes" || p_value == "no")) {
+		m_polarityCaching = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "random") {
+		std::istringstream value(p_value);
+		double frequency;
+		if (value >> frequency && value.eof() && frequency >= 0.0 && frequency <= 1.0) {
+			m_randomFrequency = frequency;
+			return true;
+		}
+	}
+
+	if (p_key == "ties" && (p_value == "id" || p_value == "random")) {
+		m_randomTies = (p_value == "random");
+		return true;
+	}
+
+	if (p_key == "seed") {
+		std::istringstream value(p_value);
+		std::uint64_t seed;
+		if (p_value.find('-') == std::string::npos && value >> seed && value.eof()) {
+			m_seed = seed;
+			return true;
+		}
+	}
+
+	if (p_key == "probing" && (p_value == "yes" || p_value == "no")) {
+		m_probing = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "equivalence" && (p_value == "yes" || p_value == "no")) {
+		m_equivalence = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "subsumption" && (p_value == "yes" || p_value == "no")) {
+		m_subsumption = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "blocked" && (p_value == "yes" || p_value == "no")) {
+		m_blockedClauseElimination = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "elimination" && (p_value == "yes" || p_value == "no")) {
+		m_variableElimination = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "symmetry" && (p_value == "yes" || p_value == "no")) {
+		m_symmetryBreaking = (p_value == "yes");
+		return true;
+	}
+
+	if (p_key == "effort") {
+		std::istringstream value(p_value);
+		double effort;
+		if (value >> effort && value.eof() && effort > 0.0) {
+			m_preprocessingEffort = effort;
+			return true;
+		}
+	}
+
+	if (p_key == "components" && (p_value == "yes" || p_value == "no")) {
+		m_components = (p_value == "yes");
+		return true;
+	}
+
+	log_error(log_dpll, "Unknown strategy setting %s=%s.", p_key.c_str(), p_value.c_str());
+	return false;
+}
+
+
+/**
+ * Gives the name of the variable selector.
+ */
+const std::string& Strategy::variableSelector() const {
+	return m_variableSelector;
+}
+
+
+/**
+ * Gives the name of the polarity selector.
+ */
+const std::string& Strategy::polaritySelector() const {
+	return m_polaritySelector;
+}
+
+
+/**
+ * Tells whether the polarities are cached between decisions.
+ */
+bool Strategy::polarityCaching() const {
+	return m_polarityCaching;
+}
+
+
+/**
+ * Gives the probability of a random decision.
+ */
+double Strategy::randomFrequency() const {
+	return m_randomFrequency;
+}
+
+
+/**
+ * Tells whether the ties between variables are broken randomly.
+ */
+bool Strategy::randomTies() const {
+	return m_randomTies;
+}
+
+
+/**
+ * Gives the seed of the random decisions.
+ */
+std::uint64_t Strategy::seed() const {
+	return m_seed;
+}
+
+
+/**
+ * Tells whether the strategy uses random draws.
+ */
+bool Strategy::isRandomized() const {
+	return m_randomFrequency > 0.0 || m_randomTies;
+}
+
+
+/**
+ * Tells whether the failed literals are searched before solving.
+ */
+bool Strategy::probing() const {
+	return m_probing;
+}
+
+
+/**
+ * Tells whether the equivalent literals are substituted before solving.
+ */
+bool Strategy::equivalence() const {
+	return m_equivalence;
+}
+
+
+/**
+ * Tells whether the subsumed clauses are removed before solving.
+ */
+bool Strategy::subsumption() const {
+	return m_subsumption;
+}
+
+
+/**
+ * Tells whether the blocked clauses are removed before solving.
+ */
+bool Strategy::blockedClauseElimination() const {
+	return m_blockedClauseElimination;
+}
+
+
+/**
+ * Tells whether the variables are eliminated before solving.
+ */
+bool Strategy::variableElimination() const {
+	return m_variableElimination;
+}
+
+
+/**
+ * Tells whether symmetry-breaking clauses are added before solving.
+ */
+bool Strategy::symmetryBreaking() const {
+	return m_symmetryBreaking;
+}
+
+
+/**
+ * Gives the factor applied to the budgets of the simplifications.
+ */
+double Strategy::preprocessingEffort() const {
+	return m_preprocessingEffort;
+}
+
+
+/**
+ * Tells whether the independent components of the formula are solved separately.
+ */
+bool Strategy::components() const {
+	return m_components;
+}
+
+
+/**
+ * Prints the strategy to the given stream.
+ * The seed is only printed when it is used.
+ */
+std::ostream& operator<<(std::ostream& p_outStream, const Strategy& p_strategy) {
+	p_outStream << "Strategy [ variable=" << p_strategy.m_variableSelector <<
+			"  polarity=" << p_strategy.m_polaritySelector <<
+			"  caching="  << (p_strategy.m_polarityCaching ? "yes" : "no") <<
+			"  random="   << p_strategy.m_randomFrequency <<
+			"  ties="     << (p_strategy.m_randomTies ? "random" : "id");
+	if (p_strategy.isRandomized())
+		p_outStream << "  seed=" << p_strategy.m_seed;
+	p_outStream << "  probing=" << (p_strategy.m_probing ? "yes" : "no");
+	p_outStream << "  equivalence=" << (p_strategy.m_equivalence ? "yes" : "no");
+	p_outStream << "  subsumption=" << (p_strategy.m_subsumption ? "yes" : "no");
+	p_outStream << "  blocked=" << (p_strategy.m_blockedClauseElimination ? "yes" : "no");
+	p_outStream << "  elimination=" << (p_strategy.m_variableElimination ? "yes" : "no");
+	p_outStream << "  symmetry=" << (p_strategy.m_symmetryBreaking ? "yes" : "no");
+	p_outStream << "  effort=" << p_strategy.m_preprocessingEffort;
+	p_outStream << "  components=" << (p_strategy.m_components ? "yes" : "no");
+	p_outStream << " ]";
+	return p_outStream;
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
@@ -0,0 +1,203 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+/**
+ * @brief The solving configuration chosen for an instance.
+ * It names the heuristics to build; the settings are given as
+ * key=value pairs, as found in a strategy table.
+ *
+ * @see StrategyTable
+ */
+class Strategy {
+public:
+	/**
+	 * Creates the default strategy: most used variable, most used polarity,
+	 * no random decision, ties broken by smallest id, all the simplifications
+	 * but blocked clause elimination and symmetry breaking, and independent
+	 * components solved separately.
+	 */
+	Strategy();
+
+	/**
+	 * Changes a setting of the strategy.
+	 * The known settings are:
+	 *  - variable = first | mostused | leastused | static | indexed
+	 *  - polarity = positive | mostused | leastused
+	 *  - caching  = yes | no
+	 *  - random   = <frequency of the random decisions, between 0 and 1>
+	 *  - ties     = id | random
+	 *  - seed     = <seed of the random decisions>
+	 *  - probing     = yes | no
+	 *  - equivalence = yes | no
+	 *  - subsumption = yes | no
+	 *  - blocked     = yes | no
+	 *  - elimination = yes | no
+	 *  - symmetry    = yes | no
+	 *  - effort      = <factor applied to the budgets of the simplifications, above 0>
+	 *  - components  = yes | no
+	 *
+	 * @param p_key
+	 *            the name of the setting
+	 * @param p_value
+	 *            the new value
+	 *
+	 * @return true if the setting was changed,
+	 *         false if the key or the value is unknown
+	 */
+	bool set(const std::string& p_key, const std::string& p_value);
+
+	/**
+	 * Gives the name of the variable selector.
+	 */
+	const std::string& variableSelector() const;
+
+	/**
+	 * Gives the name of the polarity selector.
+	 */
+	const std::string& polaritySelector() const;
+
+	/**
+	 * Tells whether the polarities are cached between decisions.
+	 */
+	bool polarityCaching() const;
+
+	/**
+	 * Gives the probability of a random decision.
+	 */
+	double randomFrequency() const;
+
+	/**
+	 * Tells whether the ties between variables are broken randomly.
+	 */
+	bool randomTies() const;
+
+	/**
+	 * Gives the seed of the random decisions.
+	 */
+	std::uint64_t seed() const;
+
+	/**
+	 * Tells whether the strategy uses random draws.
+	 */
+	bool isRandomized() const;
+
+	/**
+	 * Tells whether the failed literals are searched before solving.
+	 */
+	bool probing() const;
+
+	/**
+	 * Tells whether the equivalent literals are substituted before solving.
+	 */
+	bool equivalence() const;
+
+	/**
+	 * Tells whether the subsumed clauses are removed before solving.
+	 */
+	bool subsumption() const;
+
+	/**
+	 * Tells whether the blocked clauses are removed before solving.
+	 */
+	bool blockedClauseElimination() const;
+
+	/**
+	 * Tells whether the variables are eliminated before solving.
+	 */
+	bool variableElimination() const;
+
+	/**
+	 * Tells whether symmetry-breaking clauses are added before solving.
+	 */
+	bool symmetryBreaking() const;
+
+	/**
+	 * Gives the factor applied to the budgets of the simplifications.
+	 */
+	double preprocessingEffort() const;
+
+	/**
+	 * Tells whether the independent components of the formula are solved separately.
+	 */
+	bool components() const;
+
+	/**
+	 * Prints the strategy to the given stream.
+	 */
+	friend std::ostream& operator<<(std::ostream& p_outStream, const Strategy& p_strategy);
+
+private:
+	/** The variable selection heuristic. */
+	std::string m_variableSelector;
+
+	/** The polarity selection heuristic. */
+	std::string m_polaritySelector;
+
+	/** Whether the polarity selector is wrapped in a PolarityCachingSelector. */
+	bool m_polarityCaching;
+
+	/** The probability of a random decision. */
+	double m_randomFrequency;
+
+	/** Whether the ties are broken randomly instead of by smallest id. */
+	bool m_randomTies;
+
+	/** The seed of the random decisions. */
+	std::uint64_t m_seed;
+
+	/** Whether the formula is simplified by failed literal probing. */
+	bool m_probing;
+
+	/** Whether the formula is simplified by equivalent literal substitution. */
+	bool m_equivalence;
+
+	/** Whether the formula is simplified by subsumption and self-subsuming resolution. */
+	bool m_subsumption;
+
+	/** Whether the formula is simplified by blocked clause elimination. */
+	bool m_blockedClauseElimination;
+
+	/** Whether the formula is simplified by bounded variable elimination. */
+	bool m_variableElimination;
+
+	/** Whether symmetry-breaking clauses are added to the formula. */
+	bool m_symmetryBreaking;
+
+	/** The factor applied to the budgets of the simplifications. */
+	double m_preprocessingEffort;
+
+	/** Whether the independent components of the formula are solved separately. */
+	bool m_components;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STRATEGY_H
@@ -0,0 +1,119 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "StrategySelectors.h"
+
+#include "Strategy.h"
+#include "ListenableSolver.h"
+#include "FirstVariableSelector.h"
+#include "MostUsedVariableSelector.h"
+#include "LeastUsedVariableSelector.h"
+#include "StaticOrderVariableSelector.h"
+#include "IndexedMostUsedVariableSelector.h"
+#include "PositiveFirstPolaritySelector.h"
+#include "MostUsedPolaritySelector.h"
+#include "LeastUsedPolaritySelector.h"
+#include "utils.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+// CONSTRUCTORS
+/**
+ * Builds the selectors of a strategy.
+ *
+ * @param p_strategy
+ *            the strategy to implement
+ * @param p_formula
+ *            the formula to solve
+ */
+StrategySelectors::StrategySelectors(const Strategy& p_strategy, Formula& p_formula) {
+	if (p_strategy.isRandomized())
+		m_randomizer = std::make_unique<Randomizer>(p_strategy.seed());
+
+	// Variable selector
+	if (p_strategy.variableSelector() == "first")
+		m_variableSelector = std::make_unique<FirstVariableSelector>();
+	else if (p_strategy.variableSelector() == "leastused") {
+		if (p_strategy.randomTies())
+			m_variableSelector = std::make_unique<LeastUsedVariableSelector>(*m_randomizer);
+		else
+			m_variableSelector = std::make_unique<LeastUsedVariableSelector>();
+	}
+	else if (p_strategy.variableSelector() == "static")
+		m_variableSelector = std::make_unique<StaticOrderVariableSelector>(p_formula);
+	else if (p_strategy.variableSelector() == "indexed")
+		m_variableSelector = std::make_unique<IndexedMostUsedVariableSelector>(p_formula);
+	else if (p_strategy.randomTies())
+		m_variableSelector = std::make_unique<MostUsedVariableSelector>(*m_randomizer);
+	else
+		m_variableSelector = std::make_unique<MostUsedVariableSelector>();
+
+	// Polarity selector
+	if (p_strategy.polaritySelector() == "positive")
+		m_polaritySelector = std::make_unique<PositiveFirstPolaritySelector>();
+	else if (p_strategy.polaritySelector() == "leastused")
+		m_polaritySelector = std::make_unique<LeastUsedPolaritySelector>();
+	else
+		m_polaritySelector = std::make_unique<MostUsedPolaritySelector>();
+
+	// Optional polarity cache
+	PolaritySelector* polaritySelector = m_polaritySelector.get();
+	if (p_strategy.polarityCaching()) {
+		m_cachingSelector = std::make_unique<PolarityCachingSelector>(*m_polaritySelector);
+		polaritySelector = m_cachingSelector.get();
+	}
+
+	// Optional random decisions
+	VariableSelector* variableSelector = m_variableSelector.get();
+	if (p_strategy.randomFrequency() > 0.0) {
+		m_randomVariableSelector = std::make_unique<RandomizedVariableSelector>(*variableSelector, *m_randomizer, p_strategy.randomFrequency());
+		m_randomPolaritySelector = std::make_unique<RandomizedPolaritySelector>(*polaritySelector, *m_randomizer, p_strategy.randomFrequency());
+		variableSelector = m_randomVariableSelector.get();
+		polaritySelector = m_randomPolaritySelector.get();
+	}
+
+	// Literal selector
+	m_literalSelector = std::make_unique<VariablePolarityLiteralSelector>(*variableSelector, *polaritySelector);
+}
+
+
+// METHODS
+/**
+ * Gives the literal selector to give to the solver.
+ */
+LiteralSelector& StrategySelectors::literalSelector() {
+	return *m_literalSelector;
+}
+
+
+/**
+ * Registers the selectors that need to listen to the solver.
+ *
+ * @param p_solver
+ *            the solver that uses #literalSelector()
+ */
+void StrategySelectors::attach(ListenableSolver& p_solver) {
+	if (notNull(m_cachingSelector))
+		p_solver.addListener(*m_cachingSelector);
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
@@ -0,0 +1,98 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STRATEGY_SELECTORS_H
+#define STRATEGY_SELECTORS_H
+
+#include <memory>
+#include "VariableSelector.h"
+#include "PolaritySelector.h"
+#include "VariablePolarityLiteralSelector.h"
+#include "PolarityCachingSelector.h"
+#include "RandomizedVariableSelector.h"
+#include "RandomizedPolaritySelector.h"
+#include "Randomizer.h"
+
+
+namespace sat {
+
+class Formula;
+
+namespace solver {
+
+class ListenableSolver;
+
+namespace selectors {
+
+class Strategy;
+
+
+/**
+ * @brief Builds and owns the selectors named by a Strategy.
+ */
+class StrategySelectors {
+public:
+	/**
+	 * Builds the selectors of a strategy.
+	 *
+	 * @param p_strategy
+	 *            the strategy to implement
+	 * @param p_formula
+	 *            the formula to solve
+	 */
+	StrategySelectors(const Strategy& p_strategy, Formula& p_formula);
+
+	/**
+	 * Gives the literal selector to give to the solver.
+	 */
+	LiteralSelector& literalSelector();
+
+	/**
+	 * Registers the selectors that need to listen to the solver.
+	 *
+	 * @param p_solver
+	 *            the solver that uses #literalSelector()
+	 */
+	void attach(ListenableSolver& p_solver);
+
+private:
+	/** The source of randomness, for the randomized strategies only. */
+	std::unique_ptr<Randomizer> m_randomizer;
+
+	/** The variable selection heuristic. */
+	std::unique_ptr<VariableSelector> m_variableSelector;
+
+	/** The polarity selection heuristic. */
+	std::unique_ptr<PolaritySelector> m_polaritySelector;
+
+	/** The optional polarity cache, wrapping m_polaritySelector. */
+	std::unique_ptr<PolarityCachingSelector> m_cachingSelector;
+
+	/** The optional random decisions, wrapping the variable selector. */
+	std::unique_ptr<RandomizedVariableSelector> m_randomVariableSelector;
+
+	/** The optional random decisions, wrapping the polarity selector or its cache. */
+	std::unique_ptr<RandomizedPolaritySelector> m_randomPolaritySelector;
+
+	/** The combination of the variable and the polarity selectors. */
+	std::unique_ptr<VariablePolarityLiteralSelector> m_literalSelector;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STRATEGY_SELECTORS_H
@@ -0,0 +1,194 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "StrategyTable.h"
+
+#include <fstream>
+#include <sstream>
+#include "FormulaFeatures.h"
+#include "log.h"
+
+
+namespace sat {
+namespace solver {
+namespace selectors {
+
+
+/** The rules used when no strategy file is given. */
+static const char* const DEFAULT_RULES[] = {
+	// Sudoku-like encodings: mostly binary "at most one" clauses
+	"binaryClauseRatio>=0.8 hornClauseRatio>=0.9 -> variable=leastused polarity=positive",
+	// Everything else
+	"-> variable=mostused polarity=mostused"
+};
+
+
+// CONSTRUCTORS
+/**
+ * Creates a table with the built-in rules.
+ */
+StrategyTable::StrategyTable() {
+	for (const auto& rule : DEFAULT_RULES)
+		parseRule(rule);
+}
+
+
+// METHODS
+/**
+ * Replaces the rules by the ones of a strategy file.
+ *
+ * @param p_filename
+ *            the name of the file to load
+ *
+ * @return true if the file was loaded,
+ *         false if it could not be read or contains an invalid rule
+ */
+bool StrategyTable::load(const char* p_filename) {
+	log_debug(log_dpll, "Loading strategies from file '%s'...", p_filename);
+
+	std::ifstream file(p_filename);
+	if (!file.is_open()) {
+		log_error(log_dpll, "Could not open file '%s'.", p_filename);
+		return false;
+	}
+
+	m_rules.clear();
+	std::string line;
+	auto lineNo = 0;
+	while (getline(file, line)) {
+		lineNo++;
+
+		// Ignore empty and comment lines
+		auto start = line.find_first_not_of(" \t");
+		if (start == std::string::npos || line[start] == '#')
+			continue;
+
+		if (!parseRule(line)) {
+			log_error(log_dpll, "Invalid rule at line %d of '%s'.", lineNo, p_filename);
+			return false;
+		}
+	}
+
+	log_info(log_dpll, "%lu strategies loaded from file '%s'.", m_rules.size(), p_filename);
+	return true;
+}
+
+
+/**
+ * Selects the strategy for a formula.
+ *
+ * @param p_features
+ *            the features of the formula
+ *
+ * @return the strategy of the first matching rule,
+ *         or the default strategy if no rule matches
+ */
+Strategy StrategyTable::select(const FormulaFeatures& p_features) const {
+	Strategy strategy;
+
+	for (const auto& rule : m_rules) {
+		auto matches = true;
+		for (const auto& condition : rule.conditions)
+			matches = matches && condition.holds(p_features);
+
+		if (matches) {
+			for (const auto& setting : rule.settings)
+				strategy.set(setting.first, setting.second);
+			break;
+		}
+	}
+
+	return strategy;
+}
+
+
+/**
+ * Parses a rule and appends it to the table.
+ *
+ * @param p_line
+ *            the text of the rule
+ *
+ * @return true if the rule is valid,
+ *         false otherwise
+ */
+bool StrategyTable::parseRule(const std::string& p_line) {
+	auto arrow = p_line.find("->");
+	if (arrow == std::string::npos)
+		return false;
+
+	Rule rule;
+	std::string token;
+
+	// Conditions: <feature><comparison><value>
+	std::istringstream conditions(p_line.substr(0, arrow));
+	while (conditions >> token) {
+		auto operatorStart = token.find_first_of("<>=!");
+		auto operatorEnd   = token.find_first_not_of("<>=!", operatorStart);
+		if (operatorStart == std::string::npos || operatorEnd == std::string::npos)
+			return false;
+
+		Condition condition;
+		condition.feature    = token.substr(0, operatorStart);
+		condition.comparison = token.substr(operatorStart, operatorEnd - operatorStart);
+		if (!FormulaFeatures::isFeature(condition.feature))
+			return false;
+		if (condition.comparison != "<"  && condition.comparison != "<=" && condition.comparison != ">" &&
+		    condition.comparison != ">=" && condition.comparison != "==" && condition.comparison != "!=")
+			return false;
+
+		std::istringstream value(token.substr(operatorEnd));
+		if (!(value >> condition.value && value.eof()))
+			return false;
+		rule.conditions.emplace_back(condition);
+	}
+
+	// Settings: <key>=<value>
+	Strategy check;
+	std::istringstream settings(p_line.substr(arrow + 2));
+	while (settings >> token) {
+		auto equal = token.find('=');
+		if (equal == std::string::npos)
+			return false;
+
+		auto key   = token.substr(0, equal);
+		auto value = token.substr(equal + 1);
+		if (!check.set(key, value))
+			return false;
+		rule.settings.emplace_back(key, value);
+	}
+
+	m_rules.emplace_back(std::move(rule));
+	return true;
+}
+
+
+/**
+ * Tells whether the condition holds for the given features.
+ */
+bool StrategyTable::Condition::holds(const FormulaFeatures& p_features) const {
+	auto actual = p_features.value(feature).value_or(0);
+
+	if (comparison == "<")  return actual <  value;
+	if (comparison == "<=") return actual <= value;
+	if (comparison == ">")  return actual >  value;
+	if (comparison == ">=") return actual >= value;
+	if (comparison == "==") return actual == value;
+	return actual != value;
+}
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
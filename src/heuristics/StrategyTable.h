@@ -0,0 +1,111 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef STRATEGY_TABLE_H
+#define STRATEGY_TABLE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "Strategy.h"
+
+
+namespace sat {
+
+class FormulaFeatures;
+
+namespace solver {
+namespace selectors {
+
+
+/**
+ * @brief Selects a Strategy from the features of a formula.
+ *
+ * The table is an ordered list of rules. Each rule is a line made of
+ * conditions on the features, an arrow, then the settings to apply:
+ *
+ *     binaryClauseRatio>=0.9 hornClauseRatio>=0.9 -> polarity=leastused
+ *
+ * The first rule whose conditions all hold is applied on top of the
+ * default strategy. A rule without condition always matches.
+ * Empty lines and lines starting with '#' are ignored.
+ */
+class StrategyTable {
+public:
+	/**
+	 * Creates a table with the built-in rules.
+	 */
+	StrategyTable();
+
+	/**
+	 * Replaces the rules by the ones of a strategy file.
+	 *
+	 * @param p_filename
+	 *            the name of the file to load
+	 *
+	 * @return true if the file was loaded,
+	 *         false if it could not be read or contains an invalid rule
+	 */
+	bool load(const char* p_filename);
+
+	/**
+	 * Selects the strategy for a formula.
+	 *
+	 * @param p_features
+	 *            the features of the formula
+	 *
+	 * @return the strategy of the first matching rule,
+	 *         or the default strategy if no rule matches
+	 */
+	Strategy select(const FormulaFeatures& p_features) const;
+
+protected:
+	/**
+	 * Parses a rule and appends it to the table.
+	 *
+	 * @param p_line
+	 *            the text of the rule
+	 *
+	 * @return true if the rule is valid,
+	 *         false otherwise
+	 */
+	bool parseRule(const std::string& p_line);
+
+private:
+	/** A comparison of a feature with a constant. */
+	struct Condition {
+		std::string feature;
+		std::string comparison;
+		double      value;
+
+		bool holds(const FormulaFeatures& p_features) const;
+	};
+
+	/** Conditions and the settings to apply when they hold. */
+	struct Rule {
+		std::vector<Condition> conditions;
+		std::vector<std::pair<std::string, std::string>> settings;
+	};
+
+	/** The rules, in priority order. */
+	std::vector<Rule> m_rules;
+};
+
+} // namespace sat::solver::selectors
+} // namespace sat::solver
+} // namespace sat
+
+#endif // STRATEGY_TABLE_H
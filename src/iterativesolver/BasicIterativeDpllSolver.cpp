@@ -0,0 +1,383 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "BasicIterativeDpllSolver.h"
+
+#include "log.h"
+#include "utils.h"
+#include "Literal.h"
+#include "Clause.h"
+#include "Formula.h"
+#include "LiteralSelector.h"
+#include "ListenerDispatcher.h"
+#include "SpecializedDpllSolvers.h"
+
+namespace sat {
+namespace solver {
+
+
+// ENUMS
+enum class Result { UNDEFINED, SATISFIABLE, UNSATISFIABLE };
+
+
+// CONSTRUCTORS
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::BasicIterativeDpllSolver(Formula& p_formula, LiteralSelectorPolicy& p_literalSelector, ListenerPolicy& p_listeners) :
+m_formula(p_formula),
+m_conflictClause(nullptr),
+m_literalSelector(p_literalSelector),
+m_listeners(p_listeners) { }
+
+
+// METHODS
+/**
+ * Gives the current valuation.
+ *
+ * @return the current valuation
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+const Valuation& BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::getValuation() const {
+	return m_valuation;
+}
+
+
+/**
+ * Starter function of the solver.
+ * Implements Solver.
+ *
+ * @return a valuation (satisfiable or not)
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+Valuation& BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::solve() {
+	// Initialize the listeners
+	m_listeners.init();
+
+	// Solving
+	dpll();
+
+	// Cleaning the listeners
+	m_listeners.cleanup();
+
+	return m_valuation;
+}
+
+
+/**
+ * Main loop of the DPLL algorithm.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::dpll() {
+	auto result = Result::UNDEFINED;
+
+	while (result == Result::UNDEFINED) {
+		m_resolution.logCurrentLiterals();
+
+		// First, propagate all unitary clauses
+		fullUnitPropagate();
+
+		// Conflict case
+		if (isConflicting()) {
+			// Stop case
+			if (atTopLevel())
+				result = Result::UNSATISFIABLE;
+			else {
+				applyConflict();
+				//applyExplain();
+				//applySubsumption();
+				applyBackjump();
+			}
+		}
+		// General case
+		else {
+			// Restart
+			/*
+			if (m_restartStrategy.shouldRestart()) {
+				applyRestart();
+				applySimplify();
+			}
+			*/
+
+			// Forget
+			/*
+			if (m_forgetStrategy.shouldForget())
+				applyForget();
+			*/
+
+			// Stop case
+			if (allVariablesAssigned())
+				result = Result::SATISFIABLE;
+			else
+				applyDecide();
+		}
+	}
+
+	if (result == Result::UNSATISFIABLE)
+		m_valuation.setUnsatisfiable();
+	else
+		m_valuation = m_resolution.generateValuation();
+}
+
+
+// ITERATION CONTROL
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+bool BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::atTopLevel() const {
+	return m_resolution.currentLevel() <= 1;
+}
+
+
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+bool BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::allVariablesAssigned() const {
+	return !m_formula.hasVariables();
+}
+
+
+// UNIT PROPAGATION
+/**
+ * Runs a unit propagation until there is no more unit literal
+ * or a conflict is found.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::fullUnitPropagate() {
+	bool satisfiable;
+
+	do {
+		satisfiable = applyUnitPropagate();
+	} while (satisfiable);
+}
+
+
+/**
+ * Searches a unit literal and propagates it.
+ *
+ * @return {@code true} iif a unit literal is found and propagated
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+bool BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::applyUnitPropagate() {
+	// Search a unit literal
+	auto literal = m_formula.findUnitLiteral();
+
+	// Exit if there is no unit literal
+	if (isNull(literal.var()))
+		return false;
+
+	// Notify listeners
+	m_listeners.onPropagate(literal);
+
+	assertLiteral(literal);
+	return !isConflicting();
+}
+
+
+// LITERAL ASSERTION
+/**
+ * Like #reduceFormula(Literal) but also notifies the listeners of
+ * the onAssert() event.
+ *
+ * @param p_literal
+ *            the literal to propagate
+ *
+ * @see #reduceFormula(Literal)
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::assertLiteral(Literal p_literal) {
+	reduceFormula(p_literal);
+
+	// Notify the listeners
+	m_listeners.onAssert(p_literal);
+}
+
+
+/**
+ * Reduces a formula with a given literal.
+ * First, the clauses that contain the literal are removed from the formula.
+ * Then, the opposite of the literal is removed from the clauses that contain it.
+ * Last, the literal is added to the resolution stack.
+ *
+ * @param p_literal
+ *            the literal to propagate
+ *
+ * @see #removeClausesWithLiteral(Literal&)
+ * @see #removeOppositeLiteralFromClauses(Literal&)
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::reduceFormula(Literal p_literal) {
+	// Remove the clauses that contain the same sign as the given literal
+	removeClausesWithLiteral(p_literal);
+
+	// Remove the literal from the clauses that contain the oposite sign
+	removeOppositeLiteralFromClauses(p_literal);
+
+	// The variable is now empty, we can remove it
+	m_formula.removeVariable(p_literal.var());
+
+	// Add the literal to the current valuation
+	m_resolution.pushLiteral(p_literal);
+}
+
+
+/**
+ * Removes the clauses containing the given literal.
+ *
+ * @param p_literal
+ *            the literal to propagate
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::removeClausesWithLiteral(Literal& p_literal) {
+	log_info(log_dpll, "Removing clauses that contain the literal %sx%u...", (p_literal.isNegative() ? "¬" : ""), p_literal.id());
+	for (auto clause = p_literal.occurence(); notNull(clause); clause = p_literal.occurence()) {
+		log_debug(log_dpll, "Saving clause %u in the history.", clause->id());
+		m_resolution.addClause(clause);
+
+		m_formula.removeClause(clause);
+		log_info(log_dpll, "Clause %u removed.", clause->id());
+	}
+}
+
+
+/**
+ * Removes the opposite of the given literal from the clauses.
+ * If an empty clause is found, it is unsatisfiable and that clause is set as the conflict source.
+ *
+ * @param p_literal
+ *            the selected literal
+ *
+ * @see setConflictClause() if an empty (unsatisfiable) clause is produced
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::removeOppositeLiteralFromClauses(Literal& p_literal) {
+	log_info(log_dpll, "Removing literal %sx%u from the clauses.", (p_literal.isPositive() ? "¬" : ""), p_literal.id());
+	for (auto clause = p_literal.oppositeOccurence(); notNull(clause); clause = p_literal.oppositeOccurence()) {
+		log_debug(log_dpll, "Saving literal %sx%u of clause %u in the history.", (p_literal.isPositive() ? "¬" : ""), p_literal.id(), clause->id());
+		m_resolution.addLiteral(clause, -p_literal);
+
+		// Remove the literal from the clause
+		m_formula.removeLiteralFromClause(clause, -p_literal);
+
+		// Check if the clause is still satisfiable
+		if (clause->isUnsatisfiable()) {
+			log_info(log_dpll, "The produced clause is unsatisfiable.");
+			setConflictClause(clause);
+			break;
+		}
+	}
+}
+
+
+// CONFLICT
+/**
+ * Tells whether a conflict clause has been encountered or not.
+ *
+ * @return true if a conclict clause has been reached
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+bool BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::isConflicting() const {
+	return notNull(m_conflictClause);
+}
+
+
+/**
+ * Gives the conflict clause encountered.
+ *
+ * @return the conflict clause
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+std::shared_ptr<Clause> BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::getConflictClause() const {
+	return m_conflictClause;
+}
+
+
+/**
+ * Updates the conflict clause.
+ *
+ * @param p_clause
+ *            the new conflict clause
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::setConflictClause(const std::shared_ptr<Clause>& p_clause) {
+	m_conflictClause = p_clause;
+}
+
+
+/**
+ * Resets the conflict clause to nullptr.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::resetConflictClause() {
+	m_conflictClause = nullptr;
+}
+
+
+/**
+ * Applies the conflict rule.
+ * The listeners are notified of the onConflict() event,
+ * then the conflict clause is reset.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::applyConflict() {
+	// Notify the listeners
+	m_listeners.onConflict(*getConflictClause());
+
+	// Clean the conflict clause
+	resetConflictClause();
+}
+
+
+// BACKTRACKING
+/**
+ * Rewinds the whole current resolution level and try with the opposite of the last decision literal.
+ * This means the current history is replayed then the current resolution level is deleted.
+ * The listeners are notified of the onBacktrack() event.
+ * Finally, the opposite of the current decision literal is tried.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::applyBackjump() {
+	// Rewind to the last decision literal
+	auto currentLiteral = m_resolution.lastDecisionLiteral();
+	m_resolution.replay(m_formula);
+	m_resolution.popLevel();
+
+	// Notify the listeners
+	m_listeners.onBacktrack(currentLiteral);
+
+	// Try with the opposite literal
+	reduceFormula(-currentLiteral);
+}
+
+
+// DECIDE
+/**
+ * Creates a new resolution level, selects a decision literal,
+ * calls the listeners' onDecide() event then asserts the literal.
+ */
+template<class LiteralSelectorPolicy, class ListenerPolicy>
+void BasicIterativeDpllSolver<LiteralSelectorPolicy, ListenerPolicy>::applyDecide() {
+	m_resolution.nextLevel();
+
+	auto selectedLiteral = m_literalSelector.getLiteral(m_formula);
+	m_listeners.onDecide(selectedLiteral);
+
+	assertLiteral(selectedLiteral);
+}
+
+
+
+// INSTANTIATIONS
+template class BasicIterativeDpllSolver<LiteralSelector, listeners::ListenerDispatcher>;
+template class BasicIterativeDpllSolver<MostUsedLiteralSelector, DefaultListeners>;
+template class BasicIterativeDpllSolver<LeastUsedPositiveLiteralSelector, DefaultListeners>;
+
+} // namespace sat::solver
+} // namespace sat
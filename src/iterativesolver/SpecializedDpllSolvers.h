@@ -0,0 +1,57 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef SPECIALIZED_DPLL_SOLVERS_H
+#define SPECIALIZED_DPLL_SOLVERS_H
+
+#include "BasicIterativeDpllSolver.h"
+#include "StaticLiteralSelector.h"
+#include "StaticListenerList.h"
+#include "MostUsedVariableSelector.h"
+#include "LeastUsedVariableSelector.h"
+#include "MostUsedPolaritySelector.h"
+#include "PositiveFirstPolaritySelector.h"
+#include "StatisticsListener.h"
+#include "ChronoListener.h"
+
+
+namespace sat {
+namespace solver {
+
+/*
+ * The common configurations of the solver, compiled with their heuristics
+ * and listeners known statically. Their selectors break the ties by id.
+ */
+
+/** Most used variable, most used polarity: the default strategy. */
+using MostUsedLiteralSelector = StaticLiteralSelector<selectors::MostUsedVariableSelector, selectors::MostUsedPolaritySelector>;
+
+/** Least used variable, positive polarity: the strategy of the Sudoku-like encodings. */
+using LeastUsedPositiveLiteralSelector = StaticLiteralSelector<selectors::LeastUsedVariableSelector, selectors::PositiveFirstPolaritySelector>;
+
+/** The listeners of the solveSat and solveSudoku outputs. */
+using DefaultListeners = listeners::StaticListenerList<listeners::StatisticsListener, listeners::ChronoListener>;
+
+using MostUsedDpllSolver = BasicIterativeDpllSolver<MostUsedLiteralSelector, DefaultListeners>;
+using LeastUsedPositiveDpllSolver = BasicIterativeDpllSolver<LeastUsedPositiveLiteralSelector, DefaultListeners>;
+
+extern template class BasicIterativeDpllSolver<MostUsedLiteralSelector, DefaultListeners>;
+extern template class BasicIterativeDpllSolver<LeastUsedPositiveLiteralSelector, DefaultListeners>;
+
+} // namespace sat::solver
+} // namespace sat
+
+#endif // SPECIALIZED_DPLL_SOLVERS_H
@@ -85,6 +85,20 @@ void StatisticsListener::onBacktrack(Literal&) {
 }
 
 
+// METHODS
+/**
+ * Adds the counters of another listener to this one.
+ */
+StatisticsListener& StatisticsListener::operator+=(const StatisticsListener& p_stats) {
+	m_decisions    += p_stats.m_decisions;
+	m_propagations += p_stats.m_propagations;
+	m_assertions   += p_stats.m_assertions;
+	m_conflicts    += p_stats.m_conflicts;
+	m_backtracks   += p_stats.m_backtracks;
+	return *this;
+}
+
+
 /**
  * Prints the current statistics to the given stream.
  */
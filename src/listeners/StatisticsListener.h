@@ -64,6 +64,11 @@ public:
 	 */
 	void onBacktrack(Literal&) override;
 
+	/**
+	 * Adds the counters of another listener to this one.
+	 */
+	StatisticsListener& operator+=(const StatisticsListener& p_stats);
+
 	/**
 	 * Prints the current statistics to the given stream.
 	 */
@@ -0,0 +1,218 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "BlockedClauseEliminator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "ReconstructionStack.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Creates an eliminator.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the removed clauses are recorded
+ */
+BlockedClauseEliminator::BlockedClauseEliminator(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, CHECK_BUDGET),
+m_removedClauses(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "blocked".
+ */
+const char* BlockedClauseEliminator::name() const {
+	return "blocked";
+}
+
+
+/**
+ * Removes the blocked clauses.
+ *
+ * @return the number of simplifications done
+ */
+unsigned int BlockedClauseEliminator::run() {
+	return eliminate();
+}
+
+
+/**
+ * Removes the blocked clauses until none is left or the budget is exhausted.
+ * The candidate literals are kept in a priority queue on the number of
+ * occurences of their negation, which is checked again when a literal
+ * is taken out of the queue.
+ *
+ * @return the number of clauses removed by this call
+ */
+unsigned int BlockedClauseEliminator::eliminate() {
+	std::vector<std::shared_ptr<Variable>> variables;
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable) {
+		auto id = (*variable)->id();
+		if (id >= variables.size())
+			variables.resize(id + 1);
+		variables[id] = *variable;
+	}
+	m_marks.assign(variables.size(), 0);
+
+	auto cost([&variables](int literal) {
+		const auto& variable = variables[std::abs(literal)];
+		return literal > 0 ? variable->countNegativeOccurences() : variable->countPositiveOccurences();
+	});
+
+	// Queue all the literals
+	using Candidate = std::pair<unsigned int, int>;
+	std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+	std::unordered_set<int> queued;
+	for (const auto& variable : variables) {
+		if (!variable)
+			continue;
+		for (auto literal : { static_cast<int>(variable->id()), -static_cast<int>(variable->id()) }) {
+			candidates.emplace(cost(literal), literal);
+			queued.insert(literal);
+		}
+	}
+
+	auto removed = 0u;
+	while (!candidates.empty() && hasBudget()) {
+		auto [queuedCost, literal] = candidates.top();
+		candidates.pop();
+		queued.erase(literal);
+
+		const auto& variable = variables[std::abs(literal)];
+		if (variable->isUnused())
+			continue;
+
+		// The negation may occur in more clauses since the literal was queued
+		auto currentCost = cost(literal);
+		if (currentCost > queuedCost) {
+			candidates.emplace(currentCost, literal);
+			queued.insert(literal);
+			continue;
+		}
+		if (currentCost > OCCURENCE_LIMIT)
+			continue;
+
+		m_touched.clear();
+		removed += eliminate(variable, (literal > 0 ? SIGN_POSITIVE : SIGN_NEGATIVE));
+
+		// Try again the literals that may now block a clause
+		for (auto touched : m_touched) {
+			if (!variables[std::abs(touched)]->isUnused() && queued.insert(touched).second)
+				candidates.emplace(cost(touched), touched);
+		}
+	}
+
+	m_marks.clear();
+	log_info(log_preprocessing, "%u blocked clauses removed.", removed);
+	return removed;
+}
+
+
+/**
+ * Gives the number of clauses removed so far.
+ */
+unsigned int BlockedClauseEliminator::removedClauses() const {
+	return m_removedClauses;
+}
+
+
+/**
+ * Removes the clauses blocked on a literal.
+ * The negations of the other literals of the removed clauses are added
+ * to m_touched.
+ *
+ * @param p_variable
+ *            the variable of the literal
+ * @param p_sign
+ *            the sign of the literal
+ *
+ * @return the number of removed clauses
+ */
+unsigned int BlockedClauseEliminator::eliminate(const std::shared_ptr<Variable>& p_variable, int p_sign) {
+	// The witness would change the value of a frozen variable
+	if (isFrozen(p_variable->id()))
+		return 0;
+
+	std::vector<std::shared_ptr<Clause>> candidates(p_variable->beginOccurence(p_sign), p_variable->endOccurence(p_sign));
+	std::vector<std::shared_ptr<Clause>> resolved(p_variable->beginOccurence(-p_sign), p_variable->endOccurence(-p_sign));
+
+	auto removed = 0u;
+	for (const auto& clause : candidates) {
+		if (!hasBudget())
+			break;
+
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			m_marks[literal->id()] = literal->sign();
+		auto blocked = isBlocked(p_variable->id(), resolved);
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal)
+			m_marks[literal->id()] = 0;
+		if (!blocked)
+			continue;
+
+		log_debug(log_preprocessing, "Clause %u blocked on %sx%u.", clause->id(), (p_sign < 0 ? "¬" : ""), p_variable->id());
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal) {
+			if (literal->id() != p_variable->id())
+				m_touched.push_back(-literal->sign() * static_cast<int>(literal->id()));
+		}
+		reconstruction().push(Literal(p_variable, p_sign), *clause);
+		formula().deleteClause(clause);
+		++removed;
+	}
+
+	m_removedClauses += removed;
+	return removed;
+}
+
+
+/**
+ * Tells whether the marked clause is blocked on a variable: each given
+ * clause contains another literal negated in the marked clause, so that
+ * all the resolvents are tautologies.
+ *
+ * @param p_variableId
+ *            the variable of the blocking literal
+ * @param p_clauses
+ *            the clauses containing the negation of the blocking literal
+ */
+bool BlockedClauseEliminator::isBlocked(Id p_variableId, const std::vector<std::shared_ptr<Clause>>& p_clauses) {
+	return std::all_of(p_clauses.cbegin(), p_clauses.cend(), [this, p_variableId](const std::shared_ptr<Clause>& clause) {
+		spend(1);
+		return std::any_of(clause->beginLiteral(), clause->endLiteral(), [this, p_variableId](const Literal& literal) {
+			return literal.id() != p_variableId && m_marks[literal.id()] == -literal.sign();
+		});
+	});
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,132 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef BLOCKED_CLAUSE_ELIMINATOR_H
+#define BLOCKED_CLAUSE_ELIMINATOR_H
+
+#include <memory>
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+class Clause;
+class Variable;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Blocked clause elimination.
+ *
+ * A clause C is blocked on one of its literals l when all its resolvents
+ * on l are tautologies: each clause containing ¬l also contains the
+ * negation of another literal of C. Removing C keeps the formula
+ * satisfiable, and a model of the rest is fixed by setting l to true
+ * when C is not satisfied; C is recorded in the ReconstructionStack with
+ * l as witness.
+ *
+ * The literals are tried by increasing number of occurences of their
+ * negation, the cheapest first. Removing a clause may block the clauses
+ * containing the negation of one of its literals, whose literals are then
+ * tried again.
+ */
+class BlockedClauseEliminator : public PreprocessingPass {
+public:
+	/** The literals whose negation occurs in more clauses than this are not tried. */
+	static constexpr unsigned int OCCURENCE_LIMIT = 64;
+
+	/** The number of clause pairs that may be checked. */
+	static constexpr unsigned long CHECK_BUDGET = 20000000;
+
+	/**
+	 * Creates an eliminator.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the removed clauses are recorded
+	 */
+	BlockedClauseEliminator(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "blocked".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Removes the blocked clauses.
+	 *
+	 * @return the number of simplifications done
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Removes the blocked clauses until none is left or the budget is exhausted.
+	 *
+	 * @return the number of clauses removed by this call
+	 */
+	unsigned int eliminate();
+
+	/**
+	 * Gives the number of clauses removed so far.
+	 */
+	unsigned int removedClauses() const;
+
+protected:
+	/**
+	 * Removes the clauses blocked on a literal.
+	 *
+	 * @param p_variable
+	 *            the variable of the literal
+	 * @param p_sign
+	 *            the sign of the literal
+	 *
+	 * @return the number of removed clauses
+	 */
+	unsigned int eliminate(const std::shared_ptr<Variable>& p_variable, int p_sign);
+
+	/**
+	 * Tells whether the marked clause is blocked on a variable: each given
+	 * clause contains another literal negated in the marked clause.
+	 *
+	 * @param p_variableId
+	 *            the variable of the blocking literal
+	 * @param p_clauses
+	 *            the clauses containing the negation of the blocking literal
+	 */
+	bool isBlocked(Id p_variableId, const std::vector<std::shared_ptr<Clause>>& p_clauses);
+
+private:
+	/** The sign of each variable in the checked clause, 0 if it is not in the clause. */
+	std::vector<int> m_marks;
+
+	/** The literals to try again after a removal. */
+	std::vector<int> m_touched;
+
+	/** The number of removed clauses. */
+	unsigned int m_removedClauses;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // BLOCKED_CLAUSE_ELIMINATOR_H
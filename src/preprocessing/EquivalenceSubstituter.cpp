@@ -0,0 +1,295 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "EquivalenceSubstituter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <unordered_set>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "ClauseBuilder.h"
+#include "ReconstructionStack.h"
+#include "log.h"
+#include "utils.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Creates a substituter.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the equivalences are recorded
+ */
+EquivalenceSubstituter::EquivalenceSubstituter(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, std::numeric_limits<unsigned long>::max()),
+m_substitutedVariables(0),
+m_rewrittenClauses(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "equivalence".
+ */
+const char* EquivalenceSubstituter::name() const {
+	return "equivalence";
+}
+
+
+/**
+ * Substitutes the equivalent literals.
+ *
+ * @return the number of simplifications done
+ */
+unsigned int EquivalenceSubstituter::run() {
+	return substitute();
+}
+
+
+/**
+ * Substitutes the equivalent literals until no more equivalence is found,
+ * or the formula is found unsatisfiable.
+ *
+ * @return the number of variables substituted by this call
+ */
+unsigned int EquivalenceSubstituter::substitute() {
+	auto substituted = 0u;
+	for (unsigned int i = 0; i < MAX_ROUNDS; ++i) {
+		buildGraph();
+		if (!findComponents()) {
+			log_info(log_preprocessing, "A literal is equivalent to its negation, substitution stopped.");
+			break;
+		}
+
+		auto count = apply();
+		if (count == 0)
+			break;
+		substituted += count;
+	}
+
+	m_implications.clear();
+	m_representatives.clear();
+	log_info(log_preprocessing, "%u variables substituted, %u clauses rewritten.", m_substitutedVariables, m_rewrittenClauses);
+	return substituted;
+}
+
+
+/**
+ * Gives the number of variables substituted so far.
+ */
+unsigned int EquivalenceSubstituter::substitutedVariables() const {
+	return m_substitutedVariables;
+}
+
+
+/**
+ * Gives the number of clauses rewritten so far.
+ */
+unsigned int EquivalenceSubstituter::rewrittenClauses() const {
+	return m_rewrittenClauses;
+}
+
+
+/**
+ * Builds the implication graph of the binary clauses.
+ */
+void EquivalenceSubstituter::buildGraph() {
+	Id lastId = 0;
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		lastId = std::max(lastId, (*variable)->id());
+	m_implications.assign(index(-static_cast<int>(lastId)) + 1, {});
+
+	for (auto clause = formula().beginClause(); clause != formula().endClause(); ++clause) {
+		if ((*clause)->size() != 2)
+			continue;
+
+		auto first  = *(*clause)->beginLiteral();
+		auto second = *((*clause)->beginLiteral() + 1);
+		auto a = first.sign()  * static_cast<int>(first.id());
+		auto b = second.sign() * static_cast<int>(second.id());
+		m_implications[index(-a)].push_back(index(b));
+		m_implications[index(-b)].push_back(index(a));
+	}
+}
+
+
+/**
+ * Finds the strongly connected components of the implication graph with
+ * Tarjan's algorithm, without recursion, and sets the representative of
+ * each literal. As the graph is symmetric, the component of the negated
+ * literals gets the negated representative. A frozen variable is preferred
+ * as representative, the other frozen variables are their own representative.
+ *
+ * @return false if a literal is equivalent to its negation
+ */
+bool EquivalenceSubstituter::findComponents() {
+	constexpr auto UNVISITED = std::numeric_limits<unsigned int>::max();
+	auto size = m_implications.size();
+	std::vector<unsigned int> order(size, UNVISITED);
+	std::vector<unsigned int> lowLink(size, 0);
+	std::vector<bool> onStack(size, false);
+	std::vector<unsigned int> stack;
+	std::vector<std::pair<unsigned int, unsigned int>> calls; // node, next successor
+	m_representatives.assign(size, 0);
+
+	unsigned int counter = 0;
+	for (unsigned int root = 2; root < size; ++root) {
+		if (order[root] != UNVISITED)
+			continue;
+
+		calls.emplace_back(root, 0);
+		while (!calls.empty()) {
+			auto& [node, next] = calls.back();
+			if (next == 0 && order[node] == UNVISITED) {
+				order[node] = lowLink[node] = counter++;
+				stack.push_back(node);
+				onStack[node] = true;
+			}
+
+			// Visit the next successor
+			if (next < m_implications[node].size()) {
+				auto successor = m_implications[node][next++];
+				if (order[successor] == UNVISITED)
+					calls.emplace_back(successor, 0);
+				else if (onStack[successor])
+					lowLink[node] = std::min(lowLink[node], order[successor]);
+				continue;
+			}
+
+			// All the successors are visited: pop the component if node is its root
+			auto current = node;
+			if (lowLink[current] == order[current]) {
+				auto begin = std::find(stack.rbegin(), stack.rend(), current).base() - 1;
+				auto best = std::min_element(begin, stack.end(), [this](unsigned int first, unsigned int second) {
+					return std::make_pair(!isFrozen(first / 2), first / 2) < std::make_pair(!isFrozen(second / 2), second / 2);
+				});
+				auto chosen = literal(*best);
+				for (auto member = begin; member != stack.end(); ++member) {
+					if (*member / 2 == *best / 2 && *member != *best)
+						return false;
+					m_representatives[*member] = (isFrozen(*member / 2) ? literal(*member) : chosen);
+					onStack[*member] = false;
+				}
+				stack.erase(begin, stack.end());
+			}
+
+			calls.pop_back();
+			if (!calls.empty())
+				lowLink[calls.back().first] = std::min(lowLink[calls.back().first], lowLink[current]);
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * Replaces the literals by their representative in the clauses.
+ * A rewritten clause replaces the original one, it is dropped if it
+ * becomes a tautology. The equivalences are recorded before.
+ *
+ * @return the number of substituted variables
+ */
+unsigned int EquivalenceSubstituter::apply() {
+	std::vector<std::shared_ptr<Variable>> variables(m_implications.size() / 2);
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		variables[(*variable)->id()] = *variable;
+
+	// Record the equivalences and collect the clauses to rewrite
+	std::vector<std::shared_ptr<Clause>> clauses;
+	std::unordered_set<Clause*> collected;
+	auto substituted = 0u;
+	for (unsigned int id = 1; id < variables.size(); ++id) {
+		auto target = representative(id);
+		if (isNull(variables[id]) || target == static_cast<int>(id))
+			continue;
+
+		// x ↔ r as (x ∨ ¬r) and (¬x ∨ r)
+		auto& variable = variables[id];
+		Literal replacement(variables[std::abs(target)], (target > 0 ? SIGN_POSITIVE : SIGN_NEGATIVE));
+		reconstruction().push(Literal(variable, SIGN_POSITIVE), { Literal(variable, SIGN_POSITIVE), -replacement });
+		reconstruction().push(Literal(variable, SIGN_NEGATIVE), { Literal(variable, SIGN_NEGATIVE), replacement });
+		log_debug(log_preprocessing, "Variable x%u substituted by %d.", id, target);
+		++substituted;
+
+		for (auto sign : { SIGN_POSITIVE, SIGN_NEGATIVE }) {
+			for (auto clause = variable->beginOccurence(sign); clause != variable->endOccurence(sign); ++clause) {
+				if (collected.insert(clause->get()).second)
+					clauses.push_back(*clause);
+			}
+		}
+	}
+
+	// Rewrite the clauses
+	std::vector<int> literals;
+	for (const auto& clause : clauses) {
+		literals.clear();
+		auto tautology = false;
+		for (auto literal = clause->beginLiteral(); literal != clause->endLiteral() && !tautology; ++literal) {
+			auto target = representative(literal->sign() * static_cast<int>(literal->id()));
+			if (std::find(literals.cbegin(), literals.cend(), -target) != literals.cend())
+				tautology = true;
+			else if (std::find(literals.cbegin(), literals.cend(), target) == literals.cend())
+				literals.push_back(target);
+		}
+
+		if (!tautology)
+			formula().newClause(formula().nextClauseId()).withLiterals(literals).build();
+		formula().deleteClause(clause);
+		++m_rewrittenClauses;
+	}
+
+	m_substitutedVariables += substituted;
+	return substituted;
+}
+
+
+/**
+ * Gives the representative of a literal.
+ */
+int EquivalenceSubstituter::representative(int p_literal) const {
+	return m_representatives[index(p_literal)];
+}
+
+
+/**
+ * Gives the index of a literal in the graph: 2 × id for a positive
+ * literal, 2 × id + 1 for a negative one.
+ */
+unsigned int EquivalenceSubstituter::index(int p_literal) {
+	return p_literal > 0 ? 2 * p_literal : 2 * -p_literal + 1;
+}
+
+
+/**
+ * Gives the literal of an index in the graph.
+ */
+int EquivalenceSubstituter::literal(unsigned int p_index) {
+	return (p_index % 2 == 0 ? 1 : -1) * static_cast<int>(p_index / 2);
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,145 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef EQUIVALENCE_SUBSTITUTER_H
+#define EQUIVALENCE_SUBSTITUTER_H
+
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Equivalent literal substitution.
+ *
+ * Each binary clause (a ∨ b) gives two implications ¬a → b and ¬b → a.
+ * The literals of a strongly connected component of this implication graph
+ * are all equivalent: each one is replaced in all the clauses by the literal
+ * of the component with the smallest variable id, its representative.
+ * The components are found with Tarjan's algorithm.
+ *
+ * The equivalences are recorded in the ReconstructionStack as two binary
+ * clauses, which give each substituted variable the value of its
+ * representative. A component that holds a literal and its negation makes
+ * the formula unsatisfiable, it is then left untouched for the solver.
+ */
+class EquivalenceSubstituter : public PreprocessingPass {
+public:
+	/** The number of passes, as a substitution can create new binary clauses. */
+	static constexpr unsigned int MAX_ROUNDS = 3;
+
+	/**
+	 * Creates a substituter.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the equivalences are recorded
+	 */
+	EquivalenceSubstituter(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "equivalence".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Substitutes the equivalent literals.
+	 *
+	 * @return the number of simplifications done
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Substitutes the equivalent literals until no more equivalence is found.
+	 *
+	 * @return the number of variables substituted by this call
+	 */
+	unsigned int substitute();
+
+	/**
+	 * Gives the number of variables substituted so far.
+	 */
+	unsigned int substitutedVariables() const;
+
+	/**
+	 * Gives the number of clauses rewritten so far.
+	 */
+	unsigned int rewrittenClauses() const;
+
+protected:
+	/**
+	 * Builds the implication graph of the binary clauses.
+	 */
+	void buildGraph();
+
+	/**
+	 * Finds the strongly connected components of the implication graph
+	 * and sets the representative of each literal.
+	 *
+	 * @return false if a literal is equivalent to its negation
+	 */
+	bool findComponents();
+
+	/**
+	 * Replaces the literals by their representative in the clauses.
+	 *
+	 * @return the number of substituted variables
+	 */
+	unsigned int apply();
+
+	/**
+	 * Gives the representative of a literal.
+	 */
+	int representative(int p_literal) const;
+
+	/**
+	 * Gives the index of a literal in the graph.
+	 */
+	static unsigned int index(int p_literal);
+
+	/**
+	 * Gives the literal of an index in the graph.
+	 */
+	static int literal(unsigned int p_index);
+
+private:
+	/** The implied literals of each literal, by index. */
+	std::vector<std::vector<unsigned int>> m_implications;
+
+	/** The representative of each literal, by index. */
+	std::vector<int> m_representatives;
+
+	/** The number of substituted variables. */
+	unsigned int m_substitutedVariables;
+
+	/** The number of rewritten clauses. */
+	unsigned int m_rewrittenClauses;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // EQUIVALENCE_SUBSTITUTER_H
@@ -0,0 +1,393 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "FailedLiteralProber.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "ClauseBuilder.h"
+#include "ReconstructionStack.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Creates a prober.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the fixed literals are recorded
+ */
+FailedLiteralProber::FailedLiteralProber(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, PROPAGATION_BUDGET),
+m_propagated(0),
+m_conflict(false),
+m_failedLiterals(0),
+m_liftedLiterals(0),
+m_hyperBinaries(0),
+m_fixedVariables(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "probing".
+ */
+const char* FailedLiteralProber::name() const {
+	return "probing";
+}
+
+
+/**
+ * Probes the literals and applies the forced ones.
+ *
+ * @return the number of simplifications done
+ */
+unsigned int FailedLiteralProber::run() {
+	return probe();
+}
+
+
+/**
+ * Probes both polarities of every variable, by increasing id and within
+ * the budget, then applies the forced literals to the formula.
+ *
+ * @return the number of variables fixed by this call
+ */
+unsigned int FailedLiteralProber::probe() {
+	load();
+	if (!propagate()) {
+		log_info(log_preprocessing, "Conflict between the unit clauses, probing skipped.");
+		return 0;
+	}
+
+	auto binaryLimit = m_clauses.size();
+	std::vector<int> positives;
+	std::vector<int> negatives;
+	std::vector<bool> marks(m_watches.size(), false);
+	for (int id = 1; id < static_cast<int>(m_values.size()) && hasBudget(); ++id) {
+		if (m_values[id] != 0 || (m_watches[index(id)].empty() && m_watches[index(-id)].empty()))
+			continue;
+
+		auto binaries = m_binaries.size();
+		if (!probe(id, positives)) {
+			++m_failedLiterals;
+			if (!force(-id))
+				return 0;
+			continue;
+		}
+		if (!probe(-id, negatives)) {
+			++m_failedLiterals;
+			if (!force(id))
+				return 0;
+			continue;
+		}
+
+		// Watch the hyper-binary resolvents of both probes
+		if (m_binaries.size() > binaryLimit)
+			m_binaries.resize(std::max(binaries, binaryLimit));
+		for (auto binary = m_binaries.begin() + binaries; binary != m_binaries.end(); ++binary)
+			watch(*binary);
+
+		// The literals implied by both polarities are forced
+		for (auto literal : positives)
+			marks[index(literal)] = true;
+		for (auto literal : negatives) {
+			if (!marks[index(literal)] || value(literal) != 0)
+				continue;
+			log_debug(log_preprocessing, "Literal %d implied by both polarities of x%d.", literal, id);
+			++m_liftedLiterals;
+			if (!force(literal))
+				return 0;
+		}
+		for (auto literal : positives)
+			marks[index(literal)] = false;
+	}
+
+	auto fixed = m_fixedVariables;
+	apply();
+	log_info(log_preprocessing, "%u failed literals, %u lifted literals, %u hyper-binary resolvents, %u variables fixed.", m_failedLiterals, m_liftedLiterals, m_hyperBinaries, m_fixedVariables);
+	return m_fixedVariables - fixed;
+}
+
+
+/**
+ * Gives the number of failed literals found so far.
+ */
+unsigned int FailedLiteralProber::failedLiterals() const {
+	return m_failedLiterals;
+}
+
+
+/**
+ * Gives the number of literals found implied by both polarities of a variable.
+ */
+unsigned int FailedLiteralProber::liftedLiterals() const {
+	return m_liftedLiterals;
+}
+
+
+/**
+ * Gives the number of hyper-binary resolvents added so far.
+ */
+unsigned int FailedLiteralProber::hyperBinaries() const {
+	return m_hyperBinaries;
+}
+
+
+/**
+ * Gives the number of variables fixed so far.
+ */
+unsigned int FailedLiteralProber::fixedVariables() const {
+	return m_fixedVariables;
+}
+
+
+/**
+ * Copies the clauses of the formula and watches them.
+ * The unit clauses are assigned, but not propagated, and two opposed unit
+ * clauses are recorded as a conflict for propagate().
+ */
+void FailedLiteralProber::load() {
+	Id lastId = 0;
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		lastId = std::max(lastId, (*variable)->id());
+
+	m_clauses.clear();
+	m_watches.assign(index(-static_cast<int>(lastId)) + 1, {});
+	m_values.assign(lastId + 1, 0);
+	m_reasons.assign(lastId + 1, -1);
+	m_trail.clear();
+	m_propagated = 0;
+	m_conflict = false;
+	m_binaries.clear();
+
+	std::vector<int> literals;
+	for (auto clause = formula().beginClause(); clause != formula().endClause(); ++clause) {
+		literals.clear();
+		for (auto literal = (*clause)->beginLiteral(); literal != (*clause)->endLiteral(); ++literal)
+			literals.push_back(literal->sign() * static_cast<int>(literal->id()));
+
+		if (literals.size() == 1) {
+			if (value(literals[0]) == 0)
+				assign(literals[0], -1);
+			else if (value(literals[0]) < 0)
+				m_conflict = true;
+		}
+		else if (!literals.empty())
+			watch(literals);
+	}
+}
+
+
+/**
+ * Adds a clause to the copy and watches its first two literals.
+ */
+void FailedLiteralProber::watch(const std::vector<int>& p_literals) {
+	m_watches[index(p_literals[0])].push_back(m_clauses.size());
+	m_watches[index(p_literals[1])].push_back(m_clauses.size());
+	m_clauses.push_back(p_literals);
+}
+
+
+/**
+ * Assigns a literal and records the clause that implied it.
+ */
+void FailedLiteralProber::assign(int p_literal, int p_reason) {
+	auto id = std::abs(p_literal);
+	m_values[id] = (p_literal > 0 ? 1 : -1);
+	m_reasons[id] = p_reason;
+	m_trail.push_back(p_literal);
+}
+
+
+/**
+ * Propagates the assigned literals not propagated yet.
+ * When a watched literal becomes false, the clause watches another
+ * non-false literal if there is one, otherwise its other watched literal
+ * is implied, or the clause is in conflict if that one is false too.
+ *
+ * @return false on conflict
+ */
+bool FailedLiteralProber::propagate() {
+	if (m_conflict)
+		return false;
+
+	while (m_propagated < m_trail.size()) {
+		auto falsified = -m_trail[m_propagated++];
+		auto& watches = m_watches[index(falsified)];
+
+		unsigned int kept = 0;
+		for (unsigned int i = 0; i < watches.size(); ++i) {
+			auto& clause = m_clauses[watches[i]];
+			spend(1);
+			if (clause[0] == falsified)
+				std::swap(clause[0], clause[1]);
+
+			// Satisfied by the other watched literal
+			if (value(clause[0]) > 0) {
+				watches[kept++] = watches[i];
+				continue;
+			}
+
+			// Search another literal to watch
+			auto other = std::find_if(clause.begin() + 2, clause.end(), [this](int literal) { return value(literal) >= 0; });
+			if (other != clause.end()) {
+				std::swap(clause[1], *other);
+				m_watches[index(clause[1])].push_back(watches[i]);
+				continue;
+			}
+
+			watches[kept++] = watches[i];
+			if (value(clause[0]) < 0) {
+				// Conflict: keep the remaining watches
+				for (++i; i < watches.size(); ++i)
+					watches[kept++] = watches[i];
+				watches.resize(kept);
+				return false;
+			}
+			assign(clause[0], watches[i]);
+		}
+		watches.resize(kept);
+	}
+
+	return true;
+}
+
+
+/**
+ * Unassigns the literals after the given position of the trail.
+ */
+void FailedLiteralProber::backtrack(unsigned int p_level) {
+	while (m_trail.size() > p_level) {
+		m_values[std::abs(m_trail.back())] = 0;
+		m_trail.pop_back();
+	}
+	m_propagated = p_level;
+}
+
+
+/**
+ * Assigns a literal at level 0 and propagates it.
+ *
+ * @return false if the formula is unsatisfiable
+ */
+bool FailedLiteralProber::force(int p_literal) {
+	assign(p_literal, -1);
+	if (propagate())
+		return true;
+
+	log_info(log_preprocessing, "The formula is unsatisfiable, probing stopped.");
+	return false;
+}
+
+
+/**
+ * Propagates a literal at level 1, then backtracks.
+ * The literals implied by a clause of more than two literals give
+ * hyper-binary resolvents, which are added to m_binaries.
+ *
+ * @param p_literal
+ *            the literal to probe
+ * @param p_implied
+ *            receives the literals implied by the probe
+ *
+ * @return false if the propagation failed
+ */
+bool FailedLiteralProber::probe(int p_literal, std::vector<int>& p_implied) {
+	auto level = m_trail.size();
+	assign(p_literal, -1);
+	auto result = propagate();
+
+	p_implied.assign(m_trail.begin() + level + 1, m_trail.end());
+	if (result) {
+		for (auto literal : p_implied) {
+			if (m_clauses[m_reasons[std::abs(literal)]].size() > 2)
+				m_binaries.push_back({ -p_literal, literal });
+		}
+	}
+
+	backtrack(level);
+	if (!result) {
+		log_debug(log_preprocessing, "Failed literal %d.", p_literal);
+	}
+	return result;
+}
+
+
+/**
+ * Applies the literals assigned at level 0 to the formula.
+ * The hyper-binary resolvents are added first, then the clauses satisfied
+ * by a fixed literal are removed and the false literals are removed from
+ * the other clauses. The fixed literals are recorded as unit clauses,
+ * which is enough to satisfy the removed clauses.
+ */
+void FailedLiteralProber::apply() {
+	for (const auto& binary : m_binaries)
+		formula().newClause(formula().nextClauseId()).withLiterals(binary).build();
+	m_hyperBinaries += m_binaries.size();
+	m_binaries.clear();
+
+	std::vector<std::shared_ptr<Variable>> variables(m_values.size());
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		variables[(*variable)->id()] = *variable;
+
+	for (auto literal : m_trail) {
+		auto& variable = variables[std::abs(literal)];
+		if (variable->isUnused())
+			continue;
+
+		auto sign = (literal > 0 ? SIGN_POSITIVE : SIGN_NEGATIVE);
+		std::vector<std::shared_ptr<Clause>> satisfied(variable->beginOccurence(sign), variable->endOccurence(sign));
+		std::vector<std::shared_ptr<Clause>> falsified(variable->beginOccurence(-sign), variable->endOccurence(-sign));
+
+		reconstruction().push(Literal(variable, sign), { Literal(variable, sign) });
+		for (const auto& clause : satisfied)
+			formula().deleteClause(clause);
+		for (const auto& clause : falsified)
+			formula().removeLiteralFromClause(clause, Literal(variable, -sign));
+		++m_fixedVariables;
+	}
+}
+
+
+/**
+ * Gives the value of a literal: 1 if true, -1 if false, 0 if unassigned.
+ */
+int FailedLiteralProber::value(int p_literal) const {
+	return p_literal > 0 ? m_values[p_literal] : -m_values[-p_literal];
+}
+
+
+/**
+ * Gives the index of a literal in the watch lists: 2 × id for a positive
+ * literal, 2 × id + 1 for a negative one.
+ */
+unsigned int FailedLiteralProber::index(int p_literal) {
+	return p_literal > 0 ? 2 * p_literal : 2 * -p_literal + 1;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
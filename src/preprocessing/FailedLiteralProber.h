@@ -0,0 +1,210 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef FAILED_LITERAL_PROBER_H
+#define FAILED_LITERAL_PROBER_H
+
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Failed literal probing with hyper-binary resolution.
+ *
+ * Each literal is assumed at level 1 and propagated on a copy of the
+ * clauses, with two watched literals per clause:
+ *  - if the propagation fails, the negation of the literal is forced;
+ *  - the literals implied by both polarities of a variable are forced;
+ *  - a literal implied by a clause of more than two literals gets a
+ *    binary clause (¬probe ∨ literal), the hyper-binary resolvent, so that
+ *    it is implied by a single propagation afterwards. There are at most
+ *    as many of them as clauses in the formula.
+ *
+ * The forced literals are then applied to the formula: the clauses they
+ * satisfy are removed, their negations are removed from the other clauses,
+ * and they are recorded as unit clauses in the ReconstructionStack.
+ * When the formula is found unsatisfiable it is left untouched, so that its
+ * opposed unit clauses or its conflict remain for the solver to find.
+ */
+class FailedLiteralProber : public PreprocessingPass {
+public:
+	/** The number of watched clauses that may be visited by the propagations. */
+	static constexpr unsigned long PROPAGATION_BUDGET = 10000000;
+
+	/**
+	 * Creates a prober.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the fixed literals are recorded
+	 */
+	FailedLiteralProber(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "probing".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Probes the literals and applies the forced ones.
+	 *
+	 * @return the number of simplifications done
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Probes both polarities of every variable, within the budget,
+	 * then applies the forced literals to the formula.
+	 *
+	 * @return the number of variables fixed by this call
+	 */
+	unsigned int probe();
+
+	/**
+	 * Gives the number of failed literals found so far.
+	 */
+	unsigned int failedLiterals() const;
+
+	/**
+	 * Gives the number of literals found implied by both polarities of a variable.
+	 */
+	unsigned int liftedLiterals() const;
+
+	/**
+	 * Gives the number of hyper-binary resolvents added so far.
+	 */
+	unsigned int hyperBinaries() const;
+
+	/**
+	 * Gives the number of variables fixed so far.
+	 */
+	unsigned int fixedVariables() const;
+
+protected:
+	/**
+	 * Copies the clauses of the formula and watches them.
+	 */
+	void load();
+
+	/**
+	 * Adds a clause to the copy and watches its first two literals.
+	 */
+	void watch(const std::vector<int>& p_literals);
+
+	/**
+	 * Assigns a literal and records the clause that implied it.
+	 */
+	void assign(int p_literal, int p_reason);
+
+	/**
+	 * Propagates the assigned literals not propagated yet.
+	 *
+	 * @return false on conflict
+	 */
+	bool propagate();
+
+	/**
+	 * Unassigns the literals after the given position of the trail.
+	 */
+	void backtrack(unsigned int p_level);
+
+	/**
+	 * Assigns a literal at level 0 and propagates it.
+	 *
+	 * @return false if the formula is unsatisfiable
+	 */
+	bool force(int p_literal);
+
+	/**
+	 * Propagates a literal at level 1, then backtracks.
+	 *
+	 * @param p_literal
+	 *            the literal to probe
+	 * @param p_implied
+	 *            receives the literals implied by the probe
+	 *
+	 * @return false if the propagation failed
+	 */
+	bool probe(int p_literal, std::vector<int>& p_implied);
+
+	/**
+	 * Applies the literals assigned at level 0 to the formula.
+	 */
+	void apply();
+
+	/**
+	 * Gives the value of a literal: 1 if true, -1 if false, 0 if unassigned.
+	 */
+	int value(int p_literal) const;
+
+	/**
+	 * Gives the index of a literal in the watch lists.
+	 */
+	static unsigned int index(int p_literal);
+
+private:
+	/** The copy of the clauses, the first two literals are watched. */
+	std::vector<std::vector<int>> m_clauses;
+
+	/** The clauses watching each literal, by literal index. */
+	std::vector<std::vector<unsigned int>> m_watches;
+
+	/** The value of each variable: 1, -1 or 0 if unassigned. */
+	std::vector<int> m_values;
+
+	/** The clause that implied each variable, -1 for a probe. */
+	std::vector<int> m_reasons;
+
+	/** The assigned literals, in assignment order. */
+	std::vector<int> m_trail;
+
+	/** The position in the trail of the next literal to propagate. */
+	unsigned int m_propagated;
+
+	/** Whether two unit clauses of the formula are opposed. */
+	bool m_conflict;
+
+	/** The hyper-binary resolvents to add to the formula. */
+	std::vector<std::vector<int>> m_binaries;
+
+	/** The number of failed literals. */
+	unsigned int m_failedLiterals;
+
+	/** The number of literals implied by both polarities of a variable. */
+	unsigned int m_liftedLiterals;
+
+	/** The number of hyper-binary resolvents. */
+	unsigned int m_hyperBinaries;
+
+	/** The number of fixed variables. */
+	unsigned int m_fixedVariables;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // FAILED_LITERAL_PROBER_H
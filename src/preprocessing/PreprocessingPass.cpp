@@ -0,0 +1,117 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "PreprocessingPass.h"
+
+#include <algorithm>
+#include "utils.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Initializes a pass.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the removed clauses are recorded
+ * @param p_budget
+ *            the initial budget
+ */
+PreprocessingPass::PreprocessingPass(Formula& p_formula, ReconstructionStack& p_reconstruction, unsigned long p_budget) :
+m_formula(p_formula),
+m_reconstruction(p_reconstruction),
+m_budget(p_budget),
+m_frozen(nullptr) {
+}
+
+
+// METHODS
+/**
+ * Gives the remaining budget.
+ */
+unsigned long PreprocessingPass::budget() const {
+	return m_budget;
+}
+
+
+/**
+ * Changes the remaining budget.
+ */
+void PreprocessingPass::setBudget(unsigned long p_budget) {
+	m_budget = p_budget;
+}
+
+
+/**
+ * Sets the variables that the pass must keep.
+ *
+ * @param p_frozen
+ *            the ids of the frozen variables, the set must outlive the pass
+ */
+void PreprocessingPass::setFrozenVariables(const std::unordered_set<Id>& p_frozen) {
+	m_frozen = &p_frozen;
+}
+
+
+/**
+ * Gives the formula to simplify.
+ */
+Formula& PreprocessingPass::formula() {
+	return m_formula;
+}
+
+
+/**
+ * Gives the stack where the removed clauses are recorded.
+ */
+ReconstructionStack& PreprocessingPass::reconstruction() {
+	return m_reconstruction;
+}
+
+
+/**
+ * Tells whether some budget is left.
+ */
+bool PreprocessingPass::hasBudget() const {
+	return m_budget > 0;
+}
+
+
+/**
+ * Consumes some budget, down to zero.
+ *
+ * @param p_effort
+ *            the work done
+ */
+void PreprocessingPass::spend(unsigned long p_effort) {
+	m_budget -= std::min(m_budget, p_effort);
+}
+
+
+/**
+ * Tells whether a variable is frozen.
+ */
+bool PreprocessingPass::isFrozen(Id p_variableId) const {
+	return notNull(m_frozen) && m_frozen->count(p_variableId) > 0;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,133 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef PREPROCESSING_PASS_H
+#define PREPROCESSING_PASS_H
+
+#include <unordered_set>
+#include "FormulaObject.h"
+
+
+namespace sat {
+
+class Formula;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief A simplification of the formula, run by a Preprocessor.
+ *
+ * A pass works on the formula given at construction and records what it
+ * removes in the ReconstructionStack. Its effort is bounded by a budget,
+ * counted in the unit of work of the pass. A frozen variable keeps its
+ * meaning: it is never eliminated, substituted or set by a witness.
+ */
+class PreprocessingPass {
+public:
+	virtual ~PreprocessingPass() = default;
+
+	/**
+	 * Gives the name of the pass, as used in the strategies.
+	 */
+	virtual const char* name() const = 0;
+
+	/**
+	 * Simplifies the formula until nothing is left to do or the budget is exhausted.
+	 *
+	 * @return the number of simplifications done
+	 */
+	virtual unsigned int run() = 0;
+
+	/**
+	 * Gives the remaining budget.
+	 */
+	unsigned long budget() const;
+
+	/**
+	 * Changes the remaining budget.
+	 */
+	void setBudget(unsigned long p_budget);
+
+	/**
+	 * Sets the variables that the pass must keep.
+	 *
+	 * @param p_frozen
+	 *            the ids of the frozen variables, the set must outlive the pass
+	 */
+	void setFrozenVariables(const std::unordered_set<Id>& p_frozen);
+
+protected:
+	/**
+	 * Initializes a pass.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the removed clauses are recorded
+	 * @param p_budget
+	 *            the initial budget
+	 */
+	PreprocessingPass(Formula& p_formula, ReconstructionStack& p_reconstruction, unsigned long p_budget);
+
+	/**
+	 * Gives the formula to simplify.
+	 */
+	Formula& formula();
+
+	/**
+	 * Gives the stack where the removed clauses are recorded.
+	 */
+	ReconstructionStack& reconstruction();
+
+	/**
+	 * Tells whether some budget is left.
+	 */
+	bool hasBudget() const;
+
+	/**
+	 * Consumes some budget, down to zero.
+	 *
+	 * @param p_effort
+	 *            the work done
+	 */
+	void spend(unsigned long p_effort);
+
+	/**
+	 * Tells whether a variable is frozen.
+	 */
+	bool isFrozen(Id p_variableId) const;
+
+private:
+	/** The formula to simplify. */
+	Formula& m_formula;
+
+	/** The stack of removed clauses. */
+	ReconstructionStack& m_reconstruction;
+
+	/** The remaining budget. */
+	unsigned long m_budget;
+
+	/** The frozen variables, if any. */
+	const std::unordered_set<Id>* m_frozen;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // PREPROCESSING_PASS_H
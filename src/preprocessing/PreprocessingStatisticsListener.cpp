@@ -0,0 +1,60 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "PreprocessingStatisticsListener.h"
+
+#include <iomanip>
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+// INTERFACE METHODS
+/**
+ * Does nothing.
+ */
+void PreprocessingStatisticsListener::onPassStarted(const PreprocessingPass&) {
+}
+
+
+/**
+ * Records the statistics of the pass.
+ */
+void PreprocessingStatisticsListener::onPassFinished(const PreprocessingPass& p_pass, const PassStatistics& p_statistics) {
+	m_passes.emplace_back(p_pass.name(), p_statistics);
+}
+
+
+/**
+ * Prints the statistics of each pass to the given stream.
+ */
+std::ostream& operator<<(std::ostream& p_outStream, const PreprocessingStatisticsListener& p_stats) {
+	p_outStream << "Preprocessing [";
+	auto separator = " ";
+	for (const auto& [name, statistics] : p_stats.m_passes) {
+		p_outStream << separator << name << ": " << statistics.simplifications << " simplifications, " <<
+				std::showpos << -statistics.removedClauses << " clauses, " <<
+				-statistics.removedVariables << " variables, " << std::noshowpos <<
+				std::chrono::duration_cast<std::chrono::milliseconds>(statistics.duration).count() << " ms";
+		separator = "  |  ";
+	}
+	p_outStream << " ]";
+	return p_outStream;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
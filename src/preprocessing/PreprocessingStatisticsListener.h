@@ -0,0 +1,58 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef PREPROCESSING_STATISTICS_LISTENER_H
+#define PREPROCESSING_STATISTICS_LISTENER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "PreprocessorListener.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+/**
+ * @brief Statistics gathering listener.
+ * It keeps what each pass of a Preprocessor has done.
+ */
+class PreprocessingStatisticsListener : public PreprocessorListener {
+public:
+	/**
+	 * Does nothing.
+	 */
+	void onPassStarted(const PreprocessingPass&) override;
+
+	/**
+	 * Records the statistics of the pass.
+	 */
+	void onPassFinished(const PreprocessingPass& p_pass, const PassStatistics& p_statistics) override;
+
+	/**
+	 * Prints the statistics of each pass to the given stream.
+	 */
+	friend std::ostream& operator<<(std::ostream& p_outStream, const PreprocessingStatisticsListener& p_stats);
+
+private:
+	/** The name and statistics of each pass, in running order. */
+	std::vector<std::pair<std::string, PassStatistics>> m_passes;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // PREPROCESSING_STATISTICS_LISTENER_H
@@ -0,0 +1,140 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "Preprocessor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include "Formula.h"
+#include "Valuation.h"
+#include "PreprocessorListener.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Creates an empty pipeline.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ */
+Preprocessor::Preprocessor(Formula& p_formula) :
+m_formula(p_formula),
+m_effort(1.0) {
+}
+
+
+// METHODS
+/**
+ * Keeps a variable through the simplifications.
+ *
+ * @param p_variableId
+ *            the id of the variable
+ */
+void Preprocessor::freeze(Id p_variableId) {
+	m_frozen.insert(p_variableId);
+}
+
+
+/**
+ * Scales the budgets of the passes.
+ *
+ * @param p_effort
+ *            the factor applied to the budget of each pass
+ */
+void Preprocessor::setEffort(double p_effort) {
+	m_effort = p_effort;
+}
+
+
+/**
+ * Adds a listener.
+ *
+ * @param p_listener
+ *            the listener to add
+ */
+void Preprocessor::addListener(PreprocessorListener& p_listener) {
+	m_listeners.push_back(p_listener);
+}
+
+
+/**
+ * Removes a listener.
+ *
+ * @param p_listener
+ *            the listener to remove
+ */
+void Preprocessor::removeListener(PreprocessorListener& p_listener) {
+	std::erase_if(m_listeners, [&p_listener](const auto& listener) { return &listener.get() == &p_listener; });
+}
+
+
+/**
+ * Runs the passes in order, each one with its budget scaled by the effort.
+ * The clauses and variables removed by each pass are measured on the formula.
+ */
+void Preprocessor::preprocess() {
+	for (const auto& pass : m_passes) {
+		auto budget = pass->budget() * m_effort;
+		auto limit = static_cast<double>(std::numeric_limits<unsigned long>::max());
+		pass->setBudget(budget >= limit ? std::numeric_limits<unsigned long>::max() : static_cast<unsigned long>(budget));
+
+		for (const auto& listener : m_listeners)
+			listener.get().onPassStarted(*pass);
+
+		long clauses   = m_formula.countClauses();
+		long variables = m_formula.countVariables();
+		auto start = std::chrono::steady_clock::now();
+		auto simplifications = pass->run();
+		PassStatistics statistics { simplifications,
+			clauses - m_formula.countClauses(),
+			variables - m_formula.countVariables(),
+			std::chrono::steady_clock::now() - start };
+		log_info(log_preprocessing, "Pass %s: %u simplifications, %ld clauses and %ld variables removed.", pass->name(), simplifications, statistics.removedClauses, statistics.removedVariables);
+
+		for (const auto& listener : m_listeners)
+			listener.get().onPassFinished(*pass, statistics);
+	}
+}
+
+
+/**
+ * Turns a model of the simplified formula into a model of the original one.
+ * An unsatisfiable valuation is left untouched.
+ *
+ * @param p_valuation
+ *            the valuation found by the solver
+ */
+void Preprocessor::extend(solver::Valuation& p_valuation) const {
+	if (!p_valuation.isUnsatisfiable())
+		m_reconstruction.extend(p_valuation);
+}
+
+
+/**
+ * Gives the clauses removed by the passes.
+ */
+const ReconstructionStack& Preprocessor::reconstruction() const {
+	return m_reconstruction;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,150 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef PREPROCESSOR_H
+#define PREPROCESSOR_H
+
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+#include "ReconstructionStack.h"
+
+
+namespace sat {
+
+class Formula;
+
+namespace solver {
+class Valuation;
+}
+
+namespace preprocessing {
+
+class PreprocessorListener;
+
+
+/**
+ * @brief A pipeline of simplifications run between loading and solving.
+ *
+ * The passes are run once each, in the order they were added. They share
+ * a ReconstructionStack, used to turn the model of the simplified formula
+ * found by the solver into a model of the original formula, and the set of
+ * frozen variables. The budget of each pass is scaled by an effort factor.
+ *
+ * Each pass is timed, and what it removed is reported to the listeners.
+ */
+class Preprocessor {
+public:
+	/**
+	 * Creates an empty pipeline.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 */
+	explicit Preprocessor(Formula& p_formula);
+
+	/**
+	 * Appends a pass to the pipeline.
+	 *
+	 * @return the pass, built on the formula and the reconstruction stack
+	 */
+	template<class Pass>
+	Pass& addPass() {
+		auto pass = std::make_unique<Pass>(m_formula, m_reconstruction);
+		auto& result = *pass;
+		pass->setFrozenVariables(m_frozen);
+		m_passes.push_back(std::move(pass));
+		return result;
+	}
+
+	/**
+	 * Keeps a variable through the simplifications.
+	 *
+	 * @param p_variableId
+	 *            the id of the variable
+	 */
+	void freeze(Id p_variableId);
+
+	/**
+	 * Scales the budgets of the passes.
+	 *
+	 * @param p_effort
+	 *            the factor applied to the budget of each pass
+	 */
+	void setEffort(double p_effort);
+
+	/**
+	 * Adds a listener.
+	 *
+	 * @param p_listener
+	 *            the listener to add
+	 */
+	void addListener(PreprocessorListener& p_listener);
+
+	/**
+	 * Removes a listener.
+	 *
+	 * @param p_listener
+	 *            the listener to remove
+	 */
+	void removeListener(PreprocessorListener& p_listener);
+
+	/**
+	 * Runs the passes.
+	 */
+	void preprocess();
+
+	/**
+	 * Turns a model of the simplified formula into a model of the original one.
+	 * An unsatisfiable valuation is left untouched.
+	 *
+	 * @param p_valuation
+	 *            the valuation found by the solver
+	 */
+	void extend(solver::Valuation& p_valuation) const;
+
+	/**
+	 * Gives the clauses removed by the passes.
+	 */
+	const ReconstructionStack& reconstruction() const;
+
+private:
+	/** The formula to simplify. */
+	Formula& m_formula;
+
+	/** The clauses removed by the passes. */
+	ReconstructionStack m_reconstruction;
+
+	/** The passes, in running order. */
+	std::vector<std::unique_ptr<PreprocessingPass>> m_passes;
+
+	/** The ids of the frozen variables. */
+	std::unordered_set<Id> m_frozen;
+
+	/** The factor applied to the budgets. */
+	double m_effort;
+
+	/** The objects notified of the passes. */
+	std::vector<std::reference_wrapper<PreprocessorListener>> m_listeners;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // PREPROCESSOR_H
@@ -0,0 +1,76 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef PREPROCESSOR_LISTENER_H
+#define PREPROCESSOR_LISTENER_H
+
+#include <chrono>
+
+
+namespace sat {
+namespace preprocessing {
+
+class PreprocessingPass;
+
+
+/**
+ * @brief What a pass has done to the formula.
+ * The removed counts are negative when the pass added more than it removed.
+ */
+struct PassStatistics {
+	/** The number of simplifications reported by the pass. */
+	unsigned int simplifications;
+
+	/** The number of clauses removed from the formula. */
+	long removedClauses;
+
+	/** The number of variables removed from the formula. */
+	long removedVariables;
+
+	/** The time spent in the pass. */
+	std::chrono::steady_clock::duration duration;
+};
+
+
+/**
+ * Interface for Preprocessor Listeners.
+ */
+class PreprocessorListener {
+public:
+	/**
+	 * Called before a pass is run.
+	 *
+	 * @param p_pass
+	 *            the pass
+	 */
+	virtual void onPassStarted(const PreprocessingPass& p_pass) = 0;
+
+
+	/**
+	 * Called after a pass has run.
+	 *
+	 * @param p_pass
+	 *            the pass
+	 * @param p_statistics
+	 *            what the pass has done
+	 */
+	virtual void onPassFinished(const PreprocessingPass& p_pass, const PassStatistics& p_statistics) = 0;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // PREPROCESSOR_LISTENER_H
@@ -0,0 +1,239 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "ReconstructionStack.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include "Clause.h"
+#include "Variable.h"
+#include "utils.h"
+#include "Valuation.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// METHODS
+/**
+ * Records a removed clause.
+ *
+ * @param p_witness
+ *            the literal that satisfies the clause, it must belong to the clause
+ * @param p_clause
+ *            the removed clause, its literals are copied
+ */
+void ReconstructionStack::push(const Literal& p_witness, const Clause& p_clause) {
+	push(p_witness, std::vector<Literal>(p_clause.beginLiteral(), p_clause.endLiteral()));
+}
+
+
+/**
+ * Records a removed clause.
+ *
+ * @param p_witness
+ *            the literal that satisfies the clause, it must belong to the clause
+ * @param p_literals
+ *            the literals of the removed clause
+ */
+void ReconstructionStack::push(const Literal& p_witness, const std::vector<Literal>& p_literals) {
+	m_entries.push_back(Entry { p_witness, p_literals });
+}
+
+
+/**
+ * Tells whether no clause has been recorded.
+ */
+bool ReconstructionStack::isEmpty() const {
+	return m_entries.empty();
+}
+
+
+/**
+ * Gives the number of recorded clauses.
+ */
+unsigned int ReconstructionStack::size() const {
+	return m_entries.size();
+}
+
+
+/**
+ * Extends a model of the simplified formula to the removed variables
+ * and fixes it so that the removed clauses are satisfied.
+ * The removed variables without a value are set to false first.
+ * An unsatisfiable valuation is left untouched.
+ *
+ * @param p_valuation
+ *            the valuation found by the solver
+ */
+void ReconstructionStack::extend(solver::Valuation& p_valuation) const {
+	if (p_valuation.isUnsatisfiable() || m_entries.empty())
+		return;
+
+	// The signs of the valuation, by variable id
+	std::unordered_map<Id, int> signs;
+	for (const auto& literal : p_valuation.getLiterals())
+		signs[literal.id()] = literal.sign();
+
+	// The variables without a value are false
+	std::vector<Literal> missing;
+	for (const auto& entry : m_entries) {
+		for (const auto& literal : entry.literals) {
+			if (signs.emplace(literal.id(), SIGN_NEGATIVE).second)
+				missing.emplace_back(literal);
+		}
+	}
+
+	[[maybe_unused]] auto flips = replay(signs);
+
+	// Update the valuation
+	for (auto& literal : p_valuation.getLiterals()) {
+		if (signs[literal.id()] != literal.sign())
+			literal = Literal(literal.var(), signs[literal.id()]);
+	}
+	for (const auto& literal : missing)
+		p_valuation.push(Literal(literal.var(), signs[literal.id()]));
+
+	log_info(log_valuation, "Valuation extended to %zu removed variables, %u witnesses set.", missing.size(), flips);
+}
+
+
+/**
+ * Extends a model of the simplified formula given as raw literals.
+ * The removed variables without a value are set to false first.
+ *
+ * @param p_model
+ *            the literals of the model found by the solver
+ */
+void ReconstructionStack::extend(std::vector<RawLiteral>& p_model) const {
+	if (m_entries.empty())
+		return;
+
+	// The signs of the model, by variable id
+	std::unordered_map<Id, int> signs;
+	for (const auto& literal : p_model)
+		signs[literal.id()] = literal.sign();
+
+	// The variables without a value are false
+	std::vector<Id> missing;
+	for (const auto& entry : m_entries) {
+		for (const auto& literal : entry.literals) {
+			if (signs.emplace(literal.id(), SIGN_NEGATIVE).second)
+				missing.push_back(literal.id());
+		}
+	}
+
+	[[maybe_unused]] auto flips = replay(signs);
+
+	// Update the model
+	for (auto& literal : p_model) {
+		if (signs[literal.id()] != literal.sign())
+			literal = -literal;
+	}
+	for (auto id : missing)
+		p_model.emplace_back(signs[id] * static_cast<int>(id));
+
+	log_info(log_valuation, "Model extended to %zu removed variables, %u witnesses set.", missing.size(), flips);
+}
+
+
+/**
+ * Writes the entries to a stream, one per line, in removal order.
+ * Each line starts with the witness, followed by the other literals
+ * of the clause and a 0, as in a DIMACS clause.
+ *
+ * @param p_outStream
+ *            the stream to write to
+ */
+void ReconstructionStack::write(std::ostream& p_outStream) const {
+	for (const auto& entry : m_entries) {
+		p_outStream << entry.witness.sign() * static_cast<int>(entry.witness.id());
+		for (const auto& literal : entry.literals) {
+			if (literal != entry.witness)
+				p_outStream << " " << literal.sign() * static_cast<int>(literal.id());
+		}
+		p_outStream << " 0\n";
+	}
+}
+
+
+/**
+ * Appends the entries written by #write(std::ostream&).
+ * The lines starting with a 'c' are comments. The variables are created
+ * on the fly and kept by the stack.
+ *
+ * @param p_inStream
+ *            the stream to read from
+ *
+ * @return false if a line is not a valid entry
+ */
+bool ReconstructionStack::read(std::istream& p_inStream) {
+	std::string line;
+	std::vector<Literal> literals;
+	while (std::getline(p_inStream, line)) {
+		if (line.empty() || line[0] == 'c')
+			continue;
+
+		literals.clear();
+		std::istringstream values(line);
+		int value;
+		while (values >> value && value != 0) {
+			auto id = static_cast<Id>(std::abs(value));
+			auto& variable = m_variables[id];
+			if (isNull(variable))
+				variable = std::make_shared<Variable>(id);
+			literals.emplace_back(variable, value > 0 ? SIGN_POSITIVE : SIGN_NEGATIVE);
+		}
+		if (value != 0 || literals.empty()) {
+			log_error(log_valuation, "Invalid reconstruction entry '%s'.", line.c_str());
+			return false;
+		}
+		push(literals.front(), literals);
+	}
+	return true;
+}
+
+
+/**
+ * Replays the removed clauses from the last one: the witness of each
+ * clause that is not satisfied is set.
+ *
+ * @param p_signs
+ *            the sign of each variable, updated
+ *
+ * @return the number of witnesses set
+ */
+unsigned int ReconstructionStack::replay(std::unordered_map<Id, int>& p_signs) const {
+	auto flips = 0u;
+	for (auto entry = m_entries.crbegin(); entry != m_entries.crend(); ++entry) {
+		auto satisfied = std::any_of(entry->literals.cbegin(), entry->literals.cend(), [&p_signs](const Literal& literal) {
+			return p_signs[literal.id()] == literal.sign();
+		});
+		if (!satisfied) {
+			p_signs[entry->witness.id()] = entry->witness.sign();
+			++flips;
+		}
+	}
+	return flips;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,152 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef RECONSTRUCTION_STACK_H
+#define RECONSTRUCTION_STACK_H
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+#include "Literal.h"
+#include "RawLiteral.h"
+
+
+namespace sat {
+
+class Clause;
+
+namespace solver {
+class Valuation;
+}
+
+namespace preprocessing {
+
+
+/**
+ * @brief Records the clauses removed by the preprocessing, to turn a model
+ * of the simplified formula into a model of the original one.
+ *
+ * Each entry is a removed clause with a witness literal, the literal that
+ * satisfies the clause when the rest of the clause does not.
+ * The entries are replayed from the last one: a clause that is not
+ * satisfied by the valuation gets its witness set to true.
+ */
+class ReconstructionStack {
+public:
+	/**
+	 * Records a removed clause.
+	 *
+	 * @param p_witness
+	 *            the literal that satisfies the clause, it must belong to the clause
+	 * @param p_clause
+	 *            the removed clause, its literals are copied
+	 */
+	void push(const Literal& p_witness, const Clause& p_clause);
+
+	/**
+	 * Records a removed clause.
+	 *
+	 * @param p_witness
+	 *            the literal that satisfies the clause, it must belong to the clause
+	 * @param p_literals
+	 *            the literals of the removed clause
+	 */
+	void push(const Literal& p_witness, const std::vector<Literal>& p_literals);
+
+	/**
+	 * Tells whether no clause has been recorded.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Gives the number of recorded clauses.
+	 */
+	unsigned int size() const;
+
+	/**
+	 * Extends a model of the simplified formula to the removed variables
+	 * and fixes it so that the removed clauses are satisfied.
+	 * The removed variables without a value are set to false first.
+	 * An unsatisfiable valuation is left untouched.
+	 *
+	 * @param p_valuation
+	 *            the valuation found by the solver
+	 */
+	void extend(solver::Valuation& p_valuation) const;
+
+	/**
+	 * Extends a model of the simplified formula given as raw literals.
+	 * The removed variables without a value are set to false first.
+	 *
+	 * @param p_model
+	 *            the literals of the model found by the solver
+	 */
+	void extend(std::vector<RawLiteral>& p_model) const;
+
+	/**
+	 * Writes the entries to a stream, one per line, in removal order.
+	 * Each line starts with the witness, followed by the other literals
+	 * of the clause and a 0, as in a DIMACS clause.
+	 *
+	 * @param p_outStream
+	 *            the stream to write to
+	 */
+	void write(std::ostream& p_outStream) const;
+
+	/**
+	 * Appends the entries written by #write(std::ostream&).
+	 *
+	 * @param p_inStream
+	 *            the stream to read from
+	 *
+	 * @return false if a line is not a valid entry
+	 */
+	bool read(std::istream& p_inStream);
+
+private:
+	/**
+	 * Replays the removed clauses from the last one: the witness of each
+	 * clause that is not satisfied is set.
+	 *
+	 * @param p_signs
+	 *            the sign of each variable, updated
+	 *
+	 * @return the number of witnesses set
+	 */
+	unsigned int replay(std::unordered_map<Id, int>& p_signs) const;
+
+	/** A removed clause. */
+	struct Entry {
+		/** The literal that satisfies the clause. */
+		Literal witness;
+
+		/** The literals of the clause. */
+		std::vector<Literal> literals;
+	};
+
+	/** The removed clauses, in removal order. */
+	std::vector<Entry> m_entries;
+
+	/** The variables of the entries read by #read(std::istream&), that belong to no formula. */
+	std::unordered_map<Id, std::shared_ptr<Variable>> m_variables;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // RECONSTRUCTION_STACK_H
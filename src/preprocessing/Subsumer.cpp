@@ -0,0 +1,248 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "Subsumer.h"
+
+#include <algorithm>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "ReconstructionStack.h"
+#include "log.h"
+#include "utils.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+
+// CONSTRUCTORS
+/**
+ * Creates a subsumer.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the subsumed clauses are recorded
+ */
+Subsumer::Subsumer(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, CHECK_BUDGET),
+m_subsumedClauses(0),
+m_removedLiterals(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "subsumption".
+ */
+const char* Subsumer::name() const {
+	return "subsumption";
+}
+
+
+/**
+ * Removes the subsumed clauses and literals.
+ *
+ * @return the number of simplifications done
+ */
+unsigned int Subsumer::run() {
+	return simplify();
+}
+
+
+/**
+ * Removes the subsumed clauses and strengthens the clauses until
+ * no more strengthening is found or the budget is exhausted.
+ * A strengthened clause may subsume clauses that were already checked,
+ * hence the next pass.
+ *
+ * @return the number of clauses and literals removed by this call
+ */
+unsigned int Subsumer::simplify() {
+	auto before = m_subsumedClauses + m_removedLiterals;
+
+	// The marks are indexed by variable id
+	Id lastId = 0;
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		lastId = std::max(lastId, (*variable)->id());
+	m_marks.assign(lastId + 1, 0);
+
+	for (unsigned int i = 0; i < MAX_ROUNDS && hasBudget(); ++i) {
+		if (round() == 0)
+			break;
+	}
+
+	log_info(log_preprocessing, "%u clauses subsumed, %u literals removed by self-subsumption.", m_subsumedClauses, m_removedLiterals);
+	return m_subsumedClauses + m_removedLiterals - before;
+}
+
+
+/**
+ * Gives the number of clauses removed so far.
+ */
+unsigned int Subsumer::subsumedClauses() const {
+	return m_subsumedClauses;
+}
+
+
+/**
+ * Gives the number of literals removed so far.
+ */
+unsigned int Subsumer::removedLiterals() const {
+	return m_removedLiterals;
+}
+
+
+/**
+ * Does one pass over the clauses, by increasing size.
+ * A clause can only be subsumed by a clause of the same size or smaller,
+ * so they are all watched when it is checked.
+ *
+ * @return the number of literals removed by self-subsumption
+ */
+unsigned int Subsumer::round() {
+	std::vector<std::shared_ptr<Clause>> clauses(formula().beginClause(), formula().endClause());
+	std::sort(clauses.begin(), clauses.end(), [](const std::shared_ptr<Clause>& first, const std::shared_ptr<Clause>& second) {
+		return first->size() < second->size() || (first->size() == second->size() && first->id() < second->id());
+	});
+
+	m_watches.clear();
+	auto strengthened = 0u;
+	for (const auto& clause : clauses) {
+		if (!hasBudget())
+			break;
+		strengthened += check(clause);
+	}
+	m_watches.clear();
+
+	return strengthened;
+}
+
+
+/**
+ * Checks a clause against the clauses already seen, then watches it
+ * by its literal with the shortest occurence list.
+ * The clause is removed if it is subsumed, its literals are removed if
+ * they can be by self-subsumption. The empty clause is never produced:
+ * a unit clause opposed to another one is left to the solver.
+ *
+ * @param p_clause
+ *            the clause to check
+ *
+ * @return the number of literals removed from the clause
+ */
+unsigned int Subsumer::check(const std::shared_ptr<Clause>& p_clause) {
+	std::vector<Literal> literals(p_clause->beginLiteral(), p_clause->endLiteral());
+	for (const auto& literal : literals)
+		m_marks[literal.id()] = literal.sign();
+
+	auto clauseSignature = signature(*p_clause);
+	auto strengthened = 0u;
+	auto subsumed = false;
+	for (auto literal = literals.cbegin(); literal != literals.cend() && !subsumed && hasBudget(); ++literal) {
+		auto value = literal->sign() * static_cast<int>(literal->id());
+		for (auto key : { value, -value }) {
+			auto watches = m_watches.find(key);
+			if (watches == m_watches.end())
+				continue;
+
+			for (const auto& candidate : watches->second) {
+				if ((candidate.signature & ~clauseSignature) != 0 || candidate.clause->size() > p_clause->size())
+					continue;
+				if (!hasBudget())
+					break;
+				spend(1);
+
+				// Compare the literals of the candidate to the marks
+				const Literal* flipped = nullptr;
+				auto matches = true;
+				for (auto other = candidate.clause->beginLiteral(); other != candidate.clause->endLiteral() && matches; ++other) {
+					auto mark = m_marks[other->id()];
+					if (mark == other->sign())
+						continue;
+					if (mark == -other->sign() && isNull(flipped))
+						flipped = &*other;
+					else
+						matches = false;
+				}
+				if (!matches)
+					continue;
+
+				if (isNull(flipped)) {
+					subsumed = true;
+					break;
+				}
+
+				if (p_clause->size() > 1) {
+					auto removed = std::find_if(p_clause->beginLiteral(), p_clause->endLiteral(), [flipped](const Literal& other) {
+						return other.id() == flipped->id();
+					});
+					log_debug(log_preprocessing, "Clause %u strengthened by clause %u.", p_clause->id(), candidate.clause->id());
+					m_marks[flipped->id()] = 0;
+					formula().removeLiteralFromClause(p_clause, *removed);
+					clauseSignature = signature(*p_clause);
+					++strengthened;
+				}
+			}
+
+			if (subsumed)
+				break;
+		}
+	}
+
+	for (const auto& literal : literals)
+		m_marks[literal.id()] = 0;
+
+	if (subsumed) {
+		// Keep the clause, so that the variables that only occured there still get a value
+		log_debug(log_preprocessing, "Clause %u subsumed.", p_clause->id());
+		reconstruction().push(p_clause->firstLiteral(), *p_clause);
+		formula().deleteClause(p_clause);
+		++m_subsumedClauses;
+		m_removedLiterals += strengthened;
+		return strengthened;
+	}
+
+	// Watch the clause by its least watched literal
+	auto watched = std::min_element(p_clause->beginLiteral(), p_clause->endLiteral(), [this](const Literal& first, const Literal& second) {
+		auto firstWatches  = m_watches.find(first.sign()  * static_cast<int>(first.id()));
+		auto secondWatches = m_watches.find(second.sign() * static_cast<int>(second.id()));
+		return (firstWatches  == m_watches.end() ? 0 : firstWatches->second.size())
+		     < (secondWatches == m_watches.end() ? 0 : secondWatches->second.size());
+	});
+	if (watched != p_clause->endLiteral())
+		m_watches[watched->sign() * static_cast<int>(watched->id())].push_back({ p_clause, clauseSignature });
+
+	m_removedLiterals += strengthened;
+	return strengthened;
+}
+
+
+/**
+ * Computes the signature of the variables of a clause: each variable
+ * sets the bit of its id modulo 64.
+ */
+std::uint64_t Subsumer::signature(const Clause& p_clause) {
+	std::uint64_t result = 0;
+	for (auto literal = p_clause.beginLiteral(); literal != p_clause.endLiteral(); ++literal)
+		result |= std::uint64_t(1) << (literal->id() % 64);
+	return result;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,152 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef SUBSUMER_H
+#define SUBSUMER_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+class Clause;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Subsumption and self-subsuming resolution.
+ *
+ * A clause C subsumes a clause D when all the literals of C are in D:
+ * D is then redundant and removed. When all the literals of C but one are
+ * in D and that one is negated in D, the resolvent of C and D subsumes D:
+ * the negated literal is removed from D.
+ *
+ * The clauses are processed by increasing size, each one being checked
+ * against the smaller clauses already seen. Those are kept in occurence
+ * lists where each clause is watched by only one of its literals, so a
+ * check only visits the lists of the literals of the checked clause and of
+ * their negations. A 64-bit signature of the variables of each clause
+ * discards most of the candidates without looking at their literals.
+ */
+class Subsumer : public PreprocessingPass {
+public:
+	/** The number of passes over the formula, a pass is done again only if a literal was removed. */
+	static constexpr unsigned int MAX_ROUNDS = 3;
+
+	/** The number of candidate clauses that may be compared. */
+	static constexpr unsigned long CHECK_BUDGET = 50000000;
+
+	/**
+	 * Creates a subsumer.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the subsumed clauses are recorded
+	 */
+	Subsumer(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "subsumption".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Removes the subsumed clauses and literals.
+	 *
+	 * @return the number of simplifications done
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Removes the subsumed clauses and strengthens the clauses until
+	 * no more strengthening is found or the budget is exhausted.
+	 *
+	 * @return the number of clauses and literals removed by this call
+	 */
+	unsigned int simplify();
+
+	/**
+	 * Gives the number of clauses removed so far.
+	 */
+	unsigned int subsumedClauses() const;
+
+	/**
+	 * Gives the number of literals removed so far.
+	 */
+	unsigned int removedLiterals() const;
+
+protected:
+	/** A clause seen by the current pass. */
+	struct Candidate {
+		/** The clause. */
+		std::shared_ptr<Clause> clause;
+
+		/** The signature of its variables. */
+		std::uint64_t signature;
+	};
+
+	/**
+	 * Does one pass over the clauses.
+	 *
+	 * @return the number of literals removed by self-subsumption
+	 */
+	unsigned int round();
+
+	/**
+	 * Checks a clause against the clauses already seen, then watches it.
+	 *
+	 * @param p_clause
+	 *            the clause to check
+	 *
+	 * @return the number of literals removed from the clause
+	 */
+	unsigned int check(const std::shared_ptr<Clause>& p_clause);
+
+	/**
+	 * Computes the signature of the variables of a clause.
+	 * The polarities are ignored, so that the same signature filters the
+	 * candidates for both subsumption and self-subsumption.
+	 */
+	static std::uint64_t signature(const Clause& p_clause);
+
+private:
+	/** The clauses already seen by the current pass, by watched literal. */
+	std::unordered_map<int, std::vector<Candidate>> m_watches;
+
+	/** The sign of each variable in the checked clause, 0 if it is not in the clause. */
+	std::vector<int> m_marks;
+
+	/** The number of removed clauses. */
+	unsigned int m_subsumedClauses;
+
+	/** The number of removed literals. */
+	unsigned int m_removedLiterals;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // SUBSUMER_H
@@ -0,0 +1,440 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "SymmetryBreaker.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "RawLiteral.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+/**
+ * Scrambles a color, so that the sum of the colors of the neighbours of
+ * a node rarely collides for different multisets of colors.
+ */
+static std::uint64_t scramble(std::uint64_t p_color) {
+	p_color += 0x9e3779b97f4a7c15;
+	p_color = (p_color ^ (p_color >> 30)) * 0xbf58476d1ce4e5b9;
+	p_color = (p_color ^ (p_color >> 27)) * 0x94d049bb133111eb;
+	return p_color ^ (p_color >> 31);
+}
+
+
+/**
+ * Counts the nodes of each color.
+ *
+ * @param p_colors
+ *            the color of each node
+ * @param p_count
+ *            the number of colors
+ */
+static std::vector<unsigned int> histogram(const std::vector<unsigned int>& p_colors, unsigned int p_count) {
+	std::vector<unsigned int> sizes(p_count, 0);
+	for (auto color : p_colors)
+		sizes[color]++;
+	return sizes;
+}
+
+
+/**
+ * Gives the root of the orbit of a literal node.
+ * The path is halved on the way up.
+ */
+static unsigned int findOrbit(std::vector<unsigned int>& p_orbits, unsigned int p_node) {
+	while (p_orbits[p_node] != p_node) {
+		p_orbits[p_node] = p_orbits[p_orbits[p_node]];
+		p_node = p_orbits[p_node];
+	}
+	return p_node;
+}
+
+
+// CONSTRUCTORS
+/**
+ * Creates a symmetry breaker.
+ *
+ * @param p_formula
+ *            the formula to constrain
+ * @param p_reconstruction
+ *            unused, no clause is removed
+ */
+SymmetryBreaker::SymmetryBreaker(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, REFINEMENT_BUDGET),
+m_generators(0),
+m_addedClauses(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "symmetry".
+ */
+const char* SymmetryBreaker::name() const {
+	return "symmetry";
+}
+
+
+/**
+ * Adds the symmetry-breaking clauses.
+ *
+ * @return the number of clauses added
+ */
+unsigned int SymmetryBreaker::run() {
+	return breakSymmetries();
+}
+
+
+/**
+ * Searches the symmetries of the formula and adds their symmetry-breaking clauses.
+ * For each cell of the equitable coloring of the graph, the first literal
+ * is mapped to each other literal of the cell that is not yet known to be
+ * in its orbit. The clauses are only added once the search is over, so
+ * that all the generators are symmetries of the same formula.
+ *
+ * @return the number of clauses added by this call
+ */
+unsigned int SymmetryBreaker::breakSymmetries() {
+	buildGraph();
+	if (m_clauses.empty())
+		return 0;
+
+	auto literals = 2 * m_variables.size();
+	auto nodes = literals + m_clauses.size();
+
+	// Literal nodes first, then the clause nodes colored by size
+	Coloring root(nodes, 0);
+	for (auto clause = 0u; clause < m_clauses.size(); ++clause)
+		root[literals + clause] = 1 + m_clauses[clause].size();
+	auto colors = refine(root);
+
+	// The literal nodes of each cell
+	std::vector<std::vector<unsigned int>> cells(colors);
+	for (auto node = 0u; node < literals; ++node)
+		cells[root[node]].push_back(node);
+
+	std::vector<unsigned int> orbits(literals);
+	std::iota(orbits.begin(), orbits.end(), 0);
+	std::vector<Permutation> generators;
+	for (const auto& cell : cells) {
+		for (auto image = 1u; image < cell.size() && hasBudget() && generators.size() < MAX_GENERATORS; ++image) {
+			if (findOrbit(orbits, cell[image]) == findOrbit(orbits, cell[0]))
+				continue;
+
+			Coloring left(root);
+			Coloring right(root);
+			left[cell[0]] = colors;
+			right[cell[image]] = colors;
+			auto leftColors  = refine(left);
+			auto rightColors = refine(right);
+			if (leftColors != rightColors || histogram(left, leftColors) != histogram(right, rightColors))
+				continue;
+
+			Permutation permutation;
+			if (search(left, right, leftColors, permutation)) {
+				for (auto node = 0u; node < literals; ++node)
+					orbits[findOrbit(orbits, node)] = findOrbit(orbits, permutation[node]);
+				generators.push_back(std::move(permutation));
+			}
+		}
+	}
+
+	auto added = 0u;
+	for (const auto& generator : generators)
+		added += addLexLeader(generator);
+
+	m_generators += generators.size();
+	m_addedClauses += added;
+	log_info(log_preprocessing, "%zu symmetry generators found, %u symmetry-breaking clauses added.", generators.size(), added);
+	return added;
+}
+
+
+/**
+ * Gives the number of generators found so far.
+ */
+unsigned int SymmetryBreaker::generators() const {
+	return m_generators;
+}
+
+
+/**
+ * Gives the number of clauses added so far.
+ */
+unsigned int SymmetryBreaker::addedClauses() const {
+	return m_addedClauses;
+}
+
+
+/**
+ * Builds the graph of the formula.
+ * The variables are numbered by increasing id, the literal nodes come
+ * first and the clause nodes after them. Each literal node is linked to
+ * its negation and to the clauses it occurs in.
+ */
+void SymmetryBreaker::buildGraph() {
+	m_variables.clear();
+	m_clauses.clear();
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable)
+		m_variables.push_back(*variable);
+	std::sort(m_variables.begin(), m_variables.end(), [](const auto& first, const auto& second) {
+		return first->id() < second->id();
+	});
+
+	std::unordered_map<Id, unsigned int> indexes;
+	for (auto index = 0u; index < m_variables.size(); ++index)
+		indexes[m_variables[index]->id()] = index;
+
+	for (auto clause = formula().beginClause(); clause != formula().endClause(); ++clause) {
+		std::vector<unsigned int> nodes;
+		for (auto literal = (*clause)->beginLiteral(); literal != (*clause)->endLiteral(); ++literal)
+			nodes.push_back(2 * indexes[literal->id()] + (literal->isNegative() ? 1 : 0));
+		std::sort(nodes.begin(), nodes.end());
+		m_clauses.push_back(std::move(nodes));
+	}
+	std::sort(m_clauses.begin(), m_clauses.end());
+
+	// Adjacency lists
+	auto literals = 2 * m_variables.size();
+	m_offsets.assign(literals + m_clauses.size() + 1, 0);
+	for (auto node = 0u; node < literals; ++node)
+		m_offsets[node + 1] = 1;
+	for (auto clause = 0u; clause < m_clauses.size(); ++clause) {
+		for (auto node : m_clauses[clause])
+			m_offsets[node + 1]++;
+		m_offsets[literals + clause + 1] = m_clauses[clause].size();
+	}
+	std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+
+	m_neighbours.assign(m_offsets.back(), 0);
+	std::vector<unsigned int> next(m_offsets.begin(), m_offsets.end() - 1);
+	for (auto node = 0u; node < literals; ++node)
+		m_neighbours[next[node]++] = node ^ 1;
+	for (auto clause = 0u; clause < m_clauses.size(); ++clause) {
+		for (auto node : m_clauses[clause]) {
+			m_neighbours[next[node]++] = literals + clause;
+			m_neighbours[next[literals + clause]++] = node;
+		}
+	}
+}
+
+
+/**
+ * Splits the cells until the coloring is equitable.
+ * Each round sorts the nodes by color, then by a hash of the colors of
+ * their neighbours, and numbers the new cells in that order; it stops
+ * when a round splits no cell or when the budget is exhausted.
+ *
+ * @param p_colors
+ *            the coloring to refine
+ *
+ * @return the number of colors
+ */
+unsigned int SymmetryBreaker::refine(Coloring& p_colors) {
+	auto nodes = p_colors.size();
+	std::vector<std::uint64_t> hashes(nodes);
+	std::vector<unsigned int> order(nodes);
+	Coloring refined(nodes);
+
+	auto count = 0u;
+	while (true) {
+		for (auto node = 0u; node < nodes; ++node) {
+			std::uint64_t hash = 0;
+			for (auto neighbour = m_offsets[node]; neighbour < m_offsets[node + 1]; ++neighbour)
+				hash += scramble(p_colors[m_neighbours[neighbour]]);
+			hashes[node] = hash;
+		}
+		spend(nodes + m_neighbours.size());
+
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [&p_colors, &hashes](unsigned int first, unsigned int second) {
+			return p_colors[first] != p_colors[second] ? p_colors[first] < p_colors[second] : hashes[first] < hashes[second];
+		});
+
+		auto color = 0u;
+		for (auto index = 0u; index < nodes; ++index) {
+			if (index > 0 && (p_colors[order[index]] != p_colors[order[index - 1]] || hashes[order[index]] != hashes[order[index - 1]]))
+				++color;
+			refined[order[index]] = color;
+		}
+		p_colors.swap(refined);
+
+		if (color + 1 == count || !hasBudget())
+			return color + 1;
+		count = color + 1;
+	}
+}
+
+
+/**
+ * Searches an automorphism compatible with two colorings.
+ * The first node of the smallest color shared by several nodes is
+ * individualized on the left, and matched with a few nodes of the same
+ * color on the right, itself first. Once each node has its own color,
+ * each node is mapped to the node of the same color on the right.
+ *
+ * @param p_left
+ *            the coloring of the nodes
+ * @param p_right
+ *            the coloring of their images
+ * @param p_colors
+ *            the number of colors of both colorings
+ * @param p_permutation
+ *            receives the automorphism found
+ *
+ * @return true if an automorphism was found
+ */
+bool SymmetryBreaker::search(const Coloring& p_left, const Coloring& p_right, unsigned int p_colors, Permutation& p_permutation) {
+	if (!hasBudget())
+		return false;
+
+	auto nodes = p_left.size();
+	auto literals = 2 * m_variables.size();
+
+	// Discrete colorings: a single mapping to check
+	if (p_colors == nodes) {
+		std::vector<unsigned int> images(nodes);
+		for (auto node = 0u; node < nodes; ++node)
+			images[p_right[node]] = node;
+		p_permutation.resize(literals);
+		for (auto node = 0u; node < literals; ++node) {
+			p_permutation[node] = images[p_left[node]];
+			if (p_permutation[node] >= literals)
+				return false;
+		}
+		return isAutomorphism(p_permutation);
+	}
+
+	// The first node of the first non-singleton cell
+	auto sizes = histogram(p_left, p_colors);
+	auto cell = static_cast<unsigned int>(std::find_if(sizes.cbegin(), sizes.cend(), [](unsigned int size) { return size > 1; }) - sizes.cbegin());
+	auto node = static_cast<unsigned int>(std::find(p_left.cbegin(), p_left.cend(), cell) - p_left.cbegin());
+
+	std::vector<unsigned int> candidates;
+	if (p_right[node] == cell)
+		candidates.push_back(node);
+	for (auto candidate = 0u; candidate < nodes && candidates.size() < MAX_CANDIDATES; ++candidate) {
+		if (p_right[candidate] == cell && candidate != node)
+			candidates.push_back(candidate);
+	}
+
+	for (auto candidate : candidates) {
+		Coloring left(p_left);
+		Coloring right(p_right);
+		left[node] = p_colors;
+		right[candidate] = p_colors;
+		auto leftColors  = refine(left);
+		auto rightColors = refine(right);
+		if (leftColors != rightColors || histogram(left, leftColors) != histogram(right, rightColors))
+			continue;
+		if (search(left, right, leftColors, p_permutation))
+			return true;
+	}
+	return false;
+}
+
+
+/**
+ * Tells whether a permutation of the literals maps the clauses onto the clauses.
+ * The image of the negation of a literal must be the negation of its image.
+ *
+ * @param p_permutation
+ *            the image of each literal node
+ */
+bool SymmetryBreaker::isAutomorphism(const Permutation& p_permutation) const {
+	for (auto node = 0u; node < p_permutation.size(); ++node) {
+		if (p_permutation[node ^ 1] != (p_permutation[node] ^ 1))
+			return false;
+	}
+
+	std::vector<unsigned int> image;
+	for (const auto& clause : m_clauses) {
+		image.clear();
+		for (auto node : clause)
+			image.push_back(p_permutation[node]);
+		std::sort(image.begin(), image.end());
+		if (!std::binary_search(m_clauses.cbegin(), m_clauses.cend(), image))
+			return false;
+	}
+	return true;
+}
+
+
+/**
+ * Adds the first clauses of the lex-leader predicate of a generator.
+ * With x1, x2... the variables moved by σ, the predicate says that x1 ≤ σ(x1),
+ * that x1 = σ(x1) implies x2 ≤ σ(x2), and so on. Without auxiliary variables,
+ * the level i needs 2^(i-1) clauses, one per way of being equal on the
+ * previous variables, so only the first levels are added. The levels stop
+ * after a variable mapped to its negation, which cannot be equal to its image.
+ *
+ * @param p_permutation
+ *            the generator
+ *
+ * @return the number of clauses added
+ */
+unsigned int SymmetryBreaker::addLexLeader(const Permutation& p_permutation) {
+	std::vector<unsigned int> moved;
+	for (auto variable = 0u; variable < m_variables.size() && moved.size() < LEX_LEADER_DEPTH; ++variable) {
+		if (p_permutation[2 * variable] != 2 * variable)
+			moved.push_back(2 * variable);
+	}
+
+	auto added = 0u;
+	std::vector<unsigned int> nodes;
+	std::vector<RawLiteral> literals;
+	for (auto level = 0u; level < moved.size(); ++level) {
+		if (level > 0 && p_permutation[moved[level - 1]] == (moved[level - 1] ^ 1))
+			break;
+
+		for (auto equalities = 0u; equalities < (1u << level); ++equalities) {
+			// ¬xi ∨ σ(xi), unless an xj differs from σ(xj) before
+			nodes.assign({ moved[level] ^ 1, p_permutation[moved[level]] });
+			for (auto previous = 0u; previous < level; ++previous) {
+				auto node = moved[previous];
+				if (equalities & (1u << previous))
+					nodes.insert(nodes.end(), { node ^ 1, p_permutation[node] ^ 1 });
+				else
+					nodes.insert(nodes.end(), { node, p_permutation[node] });
+			}
+			std::sort(nodes.begin(), nodes.end());
+			nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+			if (std::adjacent_find(nodes.cbegin(), nodes.cend(), [](unsigned int first, unsigned int second) { return (first ^ 1) == second; }) != nodes.cend())
+				continue;
+
+			literals.clear();
+			for (auto node : nodes) {
+				auto id = static_cast<int>(m_variables[node / 2]->id());
+				literals.emplace_back(node & 1 ? -id : id);
+			}
+			formula().createClause(formula().nextClauseId(), literals);
+			++added;
+		}
+	}
+	return added;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
@@ -0,0 +1,192 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef SYMMETRY_BREAKER_H
+#define SYMMETRY_BREAKER_H
+
+#include <memory>
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+class Variable;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Static symmetry breaking.
+ *
+ * The formula is turned into a colored graph: a node per literal, linked to
+ * its negation, and a node per clause, linked to its literals and colored by
+ * its size. A permutation of the literals that maps the clauses onto the
+ * clauses is an automorphism of this graph.
+ *
+ * The automorphisms are searched by individualization and refinement: the
+ * nodes are first split into equitable cells, then a node is mapped to each
+ * other node of its cell in turn, both are given a new color, the colors
+ * are refined again on each side, and so on until all the cells are single
+ * nodes. The mapping found is kept if it maps the clauses onto the clauses.
+ * The nodes already known to be in the same orbit are not tried again.
+ *
+ * Each generator σ found adds the first clauses of its lex-leader predicate
+ * x ≤ σ(x), over the variables it moves taken by increasing id: only the
+ * smallest model of each orbit is kept. No variable is added, so the
+ * predicate is cut after a few variables. Each added clause only removes
+ * models that have a symmetric one left, so nothing has to be reconstructed.
+ */
+class SymmetryBreaker : public PreprocessingPass {
+public:
+	/** The number of node visits that may be done during the refinements. */
+	static constexpr unsigned long REFINEMENT_BUDGET = 50000000;
+
+	/** The maximum number of generators kept. */
+	static constexpr unsigned int MAX_GENERATORS = 256;
+
+	/** The number of nodes of a cell tried at each level of the search. */
+	static constexpr unsigned int MAX_CANDIDATES = 4;
+
+	/** The number of moved variables covered by the lex-leader predicate of a generator. */
+	static constexpr unsigned int LEX_LEADER_DEPTH = 6;
+
+	/**
+	 * Creates a symmetry breaker.
+	 *
+	 * @param p_formula
+	 *            the formula to constrain
+	 * @param p_reconstruction
+	 *            unused, no clause is removed
+	 */
+	SymmetryBreaker(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "symmetry".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Adds the symmetry-breaking clauses.
+	 *
+	 * @return the number of clauses added
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Searches the symmetries of the formula and adds their symmetry-breaking clauses.
+	 *
+	 * @return the number of clauses added by this call
+	 */
+	unsigned int breakSymmetries();
+
+	/**
+	 * Gives the number of generators found so far.
+	 */
+	unsigned int generators() const;
+
+	/**
+	 * Gives the number of clauses added so far.
+	 */
+	unsigned int addedClauses() const;
+
+protected:
+	/** The color of each node of the graph. */
+	using Coloring = std::vector<unsigned int>;
+
+	/** The image of each literal node. */
+	using Permutation = std::vector<unsigned int>;
+
+	/**
+	 * Builds the graph of the formula.
+	 */
+	void buildGraph();
+
+	/**
+	 * Splits the cells until the coloring is equitable: the nodes of a cell
+	 * all have as many neighbours in each cell. The new colors only depend
+	 * on the old colors and the graph, not on the numbering of the nodes,
+	 * so that two colorings of isomorphic graphs are refined the same way.
+	 *
+	 * @param p_colors
+	 *            the coloring to refine
+	 *
+	 * @return the number of colors
+	 */
+	unsigned int refine(Coloring& p_colors);
+
+	/**
+	 * Searches an automorphism compatible with two colorings.
+	 *
+	 * @param p_left
+	 *            the coloring of the nodes
+	 * @param p_right
+	 *            the coloring of their images
+	 * @param p_colors
+	 *            the number of colors of both colorings
+	 * @param p_permutation
+	 *            receives the automorphism found
+	 *
+	 * @return true if an automorphism was found
+	 */
+	bool search(const Coloring& p_left, const Coloring& p_right, unsigned int p_colors, Permutation& p_permutation);
+
+	/**
+	 * Tells whether a permutation of the literals maps the clauses onto the clauses.
+	 *
+	 * @param p_permutation
+	 *            the image of each literal node
+	 */
+	bool isAutomorphism(const Permutation& p_permutation) const;
+
+	/**
+	 * Adds the first clauses of the lex-leader predicate of a generator.
+	 *
+	 * @param p_permutation
+	 *            the generator
+	 *
+	 * @return the number of clauses added
+	 */
+	unsigned int addLexLeader(const Permutation& p_permutation);
+
+private:
+	/** The variables, by increasing id; the literal nodes of the i-th one are 2i and 2i+1. */
+	std::vector<std::shared_ptr<Variable>> m_variables;
+
+	/** The literal nodes of each clause, sorted. */
+	std::vector<std::vector<unsigned int>> m_clauses;
+
+	/** The start of the neighbours of each node in m_neighbours, plus the end. */
+	std::vector<unsigned int> m_offsets;
+
+	/** The neighbours of all the nodes. */
+	std::vector<unsigned int> m_neighbours;
+
+	/** The number of generators found. */
+	unsigned int m_generators;
+
+	/** The number of clauses added. */
+	unsigned int m_addedClauses;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // SYMMETRY_BREAKER_H
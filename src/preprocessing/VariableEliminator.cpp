@@ -0,0 +1,453 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include "VariableEliminator.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include "Formula.h"
+#include "Clause.h"
+#include "Variable.h"
+#include "Literal.h"
+#include "ClauseBuilder.h"
+#include "ReconstructionStack.h"
+#include "log.h"
+
+
+namespace sat {
+namespace preprocessing {
+
+namespace {
+
+/**
+ * Gives the DIMACS form of a literal.
+ */
+int toInt(const Literal& p_literal) {
+	return p_literal.sign() * static_cast<int>(p_literal.id());
+}
+
+
+/**
+ * Gives the two literals of a ternary clause other than the given variable, ordered.
+ */
+std::pair<int, int> otherPair(const Clause& p_clause, Id p_variableId) {
+	std::vector<int> others;
+	for (auto literal = p_clause.beginLiteral(); literal != p_clause.endLiteral(); ++literal) {
+		if (literal->id() != p_variableId)
+			others.push_back(toInt(*literal));
+	}
+	return std::minmax(others[0], others[1]);
+}
+
+
+/**
+ * Builds an ordered pair of literals.
+ */
+std::pair<int, int> makePair(int p_first, int p_second) {
+	return std::minmax(p_first, p_second);
+}
+
+
+/**
+ * Indexes the ternary clauses by their two other literals.
+ */
+std::map<std::pair<int, int>, unsigned int> indexTernaries(const std::vector<std::shared_ptr<Clause>>& p_clauses, Id p_variableId) {
+	std::map<std::pair<int, int>, unsigned int> index;
+	for (unsigned int i = 0; i < p_clauses.size(); ++i) {
+		if (p_clauses[i]->size() == 3)
+			index.emplace(otherPair(*p_clauses[i], p_variableId), i);
+	}
+	return index;
+}
+
+} // anonymous namespace
+
+
+// CONSTRUCTORS
+/**
+ * Creates an eliminator.
+ *
+ * @param p_formula
+ *            the formula to simplify
+ * @param p_reconstruction
+ *            the stack where the removed clauses are recorded
+ */
+VariableEliminator::VariableEliminator(Formula& p_formula, ReconstructionStack& p_reconstruction) :
+PreprocessingPass(p_formula, p_reconstruction, RESOLUTION_BUDGET),
+m_variableId(0),
+m_eliminatedVariables(0),
+m_eliminatedGates(0),
+m_removedClauses(0),
+m_addedClauses(0) {
+}
+
+
+// METHODS
+/**
+ * Gives the name of the pass: "elimination".
+ */
+const char* VariableEliminator::name() const {
+	return "elimination";
+}
+
+
+/**
+ * Eliminates the variables.
+ *
+ * @return the number of simplifications done
+ */
+unsigned int VariableEliminator::run() {
+	return eliminate();
+}
+
+
+/**
+ * Eliminates the variables of the formula until no elimination is possible
+ * or the budget is exhausted.
+ * The variables are tried by increasing product of their positive and
+ * negative occurences, and tried again when an elimination changes their clauses.
+ *
+ * @return the number of variables eliminated by this call
+ */
+unsigned int VariableEliminator::eliminate() {
+	auto cost([](const Variable& variable) {
+		return static_cast<unsigned long>(variable.countPositiveOccurences()) * variable.countNegativeOccurences();
+	});
+
+	// Queue all the variables
+	using Candidate = std::pair<unsigned long, Id>;
+	std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+	std::unordered_map<Id, std::shared_ptr<Variable>> variables;
+	std::unordered_set<Id> queued;
+	for (auto variable = formula().beginVariable(); variable != formula().endVariable(); ++variable) {
+		variables.emplace((*variable)->id(), *variable);
+		candidates.emplace(cost(**variable), (*variable)->id());
+		queued.insert((*variable)->id());
+	}
+
+	auto eliminated = 0u;
+	while (!candidates.empty() && hasBudget()) {
+		auto candidate = candidates.top();
+		candidates.pop();
+
+		auto& variable = variables[candidate.second];
+		if (variable->isUnused()) {
+			queued.erase(candidate.second);
+			continue;
+		}
+
+		// The cost may have grown since the variable was queued
+		auto currentCost = cost(*variable);
+		if (currentCost > candidate.first) {
+			candidates.emplace(currentCost, candidate.second);
+			continue;
+		}
+		queued.erase(candidate.second);
+
+		if (!eliminate(variable))
+			continue;
+		++eliminated;
+
+		// Try again the variables whose clauses have changed
+		for (auto id : m_touched) {
+			auto touched = variables.find(id);
+			if (touched != variables.end() && !touched->second->isUnused() && queued.insert(id).second)
+				candidates.emplace(cost(*touched->second), id);
+		}
+	}
+
+	log_info(log_preprocessing, "%u variables eliminated, %u by gate definition.", eliminated, m_eliminatedGates);
+	return eliminated;
+}
+
+
+/**
+ * Gives the number of variables eliminated so far.
+ */
+unsigned int VariableEliminator::eliminatedVariables() const {
+	return m_eliminatedVariables;
+}
+
+
+/**
+ * Gives the number of eliminations that used a gate definition.
+ */
+unsigned int VariableEliminator::eliminatedGates() const {
+	return m_eliminatedGates;
+}
+
+
+/**
+ * Gives the number of clauses removed so far.
+ */
+unsigned int VariableEliminator::removedClauses() const {
+	return m_removedClauses;
+}
+
+
+/**
+ * Gives the number of resolvents added so far.
+ */
+unsigned int VariableEliminator::addedClauses() const {
+	return m_addedClauses;
+}
+
+
+/**
+ * Tries to eliminate a variable.
+ * The elimination is done if it does not increase the number of clauses,
+ * does not produce a too big resolvent and does not produce the empty
+ * clause, which is left to the solver.
+ *
+ * @param p_variable
+ *            the variable to eliminate
+ *
+ * @return true if the variable has been eliminated
+ */
+bool VariableEliminator::eliminate(const std::shared_ptr<Variable>& p_variable) {
+	if (isFrozen(p_variable->id()))
+		return false;
+
+	m_variableId = p_variable->id();
+	m_positives.assign(p_variable->beginOccurence(SIGN_POSITIVE), p_variable->endOccurence(SIGN_POSITIVE));
+	m_negatives.assign(p_variable->beginOccurence(SIGN_NEGATIVE), p_variable->endOccurence(SIGN_NEGATIVE));
+	if (m_positives.size() > OCCURENCE_LIMIT && m_negatives.size() > OCCURENCE_LIMIT)
+		return false;
+
+	// With a gate, the resolvents between two gate clauses are tautologies
+	// and the ones between two other clauses are implied by the others
+	std::vector<bool> positiveGate(m_positives.size(), false);
+	std::vector<bool> negativeGate(m_negatives.size(), false);
+	auto gate = findGate(positiveGate, negativeGate);
+
+	// Compute the resolvents, as long as they are not more than the clauses
+	auto limit = m_positives.size() + m_negatives.size();
+	std::vector<std::vector<int>> resolvents;
+	std::vector<int> resolvent;
+	for (unsigned int i = 0; i < m_positives.size(); ++i) {
+		for (unsigned int j = 0; j < m_negatives.size(); ++j) {
+			if (gate && positiveGate[i] == negativeGate[j])
+				continue;
+			if (!hasBudget())
+				return false;
+			if (!resolve(*m_positives[i], *m_negatives[j], resolvent))
+				continue;
+			if (resolvent.empty() || resolvent.size() > RESOLVENT_SIZE_LIMIT || resolvents.size() >= limit)
+				return false;
+			resolvents.push_back(resolvent);
+		}
+	}
+
+	// Record the removed clauses
+	for (const auto& clause : m_positives)
+		reconstruction().push(Literal(p_variable, SIGN_POSITIVE), *clause);
+	for (const auto& clause : m_negatives)
+		reconstruction().push(Literal(p_variable, SIGN_NEGATIVE), *clause);
+
+	// Add the resolvents while their variables are still in the formula
+	for (const auto& literals : resolvents)
+		formula().newClause(formula().nextClauseId()).withLiterals(literals).build();
+
+	// Remove the clauses of the variable
+	m_touched.clear();
+	for (const auto& clauses : { std::cref(m_positives), std::cref(m_negatives) }) {
+		for (const auto& clause : clauses.get()) {
+			for (auto literal = clause->beginLiteral(); literal != clause->endLiteral(); ++literal) {
+				if (literal->id() != m_variableId)
+					m_touched.push_back(literal->id());
+			}
+			formula().deleteClause(clause);
+		}
+	}
+
+	++m_eliminatedVariables;
+	if (gate)
+		++m_eliminatedGates;
+	m_removedClauses += limit;
+	m_addedClauses += resolvents.size();
+	log_debug(log_preprocessing, "Variable x%u eliminated%s: %zu clauses replaced by %zu resolvents.", m_variableId, (gate ? " by gate" : ""), limit, resolvents.size());
+	return true;
+}
+
+
+/**
+ * Searches clauses that define the current variable as a gate.
+ * The gate clauses are flagged in p_positiveGate and p_negativeGate.
+ *
+ * @return true if a gate has been found
+ */
+bool VariableEliminator::findGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const {
+	return findAndGate(m_positives, p_positiveGate, m_negatives, p_negativeGate)
+		|| findAndGate(m_negatives, p_negativeGate, m_positives, p_positiveGate)
+		|| findXorGate(p_positiveGate, p_negativeGate)
+		|| findIteGate(p_positiveGate, p_negativeGate);
+}
+
+
+/**
+ * Searches an AND gate whose output is the current variable with a given sign:
+ * binary clauses (¬o ∨ a) for each input a and a clause (o ∨ ¬a1 ∨ ... ∨ ¬an).
+ * The clauses of the output o are p_outputs, the clauses of its negation are p_inputs.
+ *
+ * @return true if a gate has been found
+ */
+bool VariableEliminator::findAndGate(const std::vector<std::shared_ptr<Clause>>& p_outputs, std::vector<bool>& p_outputGate,
+                                     const std::vector<std::shared_ptr<Clause>>& p_inputs,  std::vector<bool>& p_inputGate) const {
+	// The literals implied by the output
+	std::unordered_map<int, unsigned int> implied;
+	for (unsigned int i = 0; i < p_inputs.size(); ++i) {
+		if (p_inputs[i]->size() != 2)
+			continue;
+		for (auto literal = p_inputs[i]->beginLiteral(); literal != p_inputs[i]->endLiteral(); ++literal) {
+			if (literal->id() != m_variableId)
+				implied.emplace(toInt(*literal), i);
+		}
+	}
+	if (implied.empty())
+		return false;
+
+	// A clause of the output whose other literals are all negations of implied literals
+	for (unsigned int j = 0; j < p_outputs.size(); ++j) {
+		if (p_outputs[j]->size() - 1 > implied.size())
+			continue;
+
+		auto isGate = std::all_of(p_outputs[j]->beginLiteral(), p_outputs[j]->endLiteral(), [this, &implied](const Literal& literal) {
+			return literal.id() == m_variableId || implied.count(-toInt(literal)) > 0;
+		});
+		if (!isGate)
+			continue;
+
+		p_outputGate[j] = true;
+		for (auto literal = p_outputs[j]->beginLiteral(); literal != p_outputs[j]->endLiteral(); ++literal) {
+			if (literal->id() != m_variableId)
+				p_inputGate[implied[-toInt(*literal)]] = true;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+
+/**
+ * Searches a XOR gate x = a ⊕ b, made of the clauses
+ * (¬x ∨ a ∨ b), (¬x ∨ ¬a ∨ ¬b), (x ∨ ¬a ∨ b) and (x ∨ a ∨ ¬b).
+ *
+ * @return true if a gate has been found
+ */
+bool VariableEliminator::findXorGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const {
+	auto positives = indexTernaries(m_positives, m_variableId);
+	auto negatives = indexTernaries(m_negatives, m_variableId);
+
+	for (const auto& [literals, index] : negatives) {
+		auto [a, b] = literals;
+		auto opposite = negatives.find(makePair(-a, -b));
+		auto first    = positives.find(makePair(-a,  b));
+		auto second   = positives.find(makePair( a, -b));
+		if (opposite == negatives.end() || first == positives.end() || second == positives.end())
+			continue;
+
+		p_negativeGate[index] = true;
+		p_negativeGate[opposite->second] = true;
+		p_positiveGate[first->second] = true;
+		p_positiveGate[second->second] = true;
+		return true;
+	}
+
+	return false;
+}
+
+
+/**
+ * Searches an if-then-else gate x = c ? t : e, made of the clauses
+ * (¬x ∨ ¬c ∨ t), (¬x ∨ c ∨ e), (x ∨ ¬c ∨ ¬t) and (x ∨ c ∨ ¬e).
+ *
+ * @return true if a gate has been found
+ */
+bool VariableEliminator::findIteGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const {
+	auto positives = indexTernaries(m_positives, m_variableId);
+	auto negatives = indexTernaries(m_negatives, m_variableId);
+
+	for (const auto& [literals, thenIndex] : negatives) {
+		// Each literal of (¬x ∨ u ∨ v) can be the negated condition
+		for (const auto& [notCondition, then] : { literals, std::make_pair(literals.second, literals.first) }) {
+			auto thenClause = positives.find(makePair(notCondition, -then));
+			if (thenClause == positives.end())
+				continue;
+
+			// Search (¬x ∨ c ∨ e) and (x ∨ c ∨ ¬e)
+			for (const auto& [elseLiterals, elseIndex] : negatives) {
+				if (elseLiterals.first != -notCondition && elseLiterals.second != -notCondition)
+					continue;
+				auto otherwise = (elseLiterals.first == -notCondition ? elseLiterals.second : elseLiterals.first);
+				auto elseClause = positives.find(makePair(-notCondition, -otherwise));
+				if (elseClause == positives.end())
+					continue;
+
+				p_negativeGate[thenIndex] = true;
+				p_negativeGate[elseIndex] = true;
+				p_positiveGate[thenClause->second] = true;
+				p_positiveGate[elseClause->second] = true;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+
+/**
+ * Computes the resolvent of two clauses on the current variable.
+ *
+ * @param p_positive
+ *            the clause where the variable is positive
+ * @param p_negative
+ *            the clause where the variable is negative
+ * @param p_resolvent
+ *            receives the literals of the resolvent
+ *
+ * @return false if the resolvent is a tautology
+ */
+bool VariableEliminator::resolve(const Clause& p_positive, const Clause& p_negative, std::vector<int>& p_resolvent) {
+	p_resolvent.clear();
+	spend(p_positive.size() * p_negative.size());
+
+	for (auto literal = p_positive.beginLiteral(); literal != p_positive.endLiteral(); ++literal) {
+		if (literal->id() != m_variableId)
+			p_resolvent.push_back(toInt(*literal));
+	}
+
+	for (auto literal = p_negative.beginLiteral(); literal != p_negative.endLiteral(); ++literal) {
+		if (literal->id() == m_variableId)
+			continue;
+
+		auto value = toInt(*literal);
+		if (std::find(p_resolvent.cbegin(), p_resolvent.cend(), -value) != p_resolvent.cend())
+			return false;
+		if (std::find(p_resolvent.cbegin(), p_resolvent.cend(), value) == p_resolvent.cend())
+			p_resolvent.push_back(value);
+	}
+
+	return true;
+}
+
+} // namespace sat::preprocessing
+} // namespace sat
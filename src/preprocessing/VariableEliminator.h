@@ -0,0 +1,193 @@
+/*  Copyright 2026 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#ifndef VARIABLE_ELIMINATOR_H
+#define VARIABLE_ELIMINATOR_H
+
+#include <memory>
+#include <vector>
+#include "FormulaObject.h"
+#include "PreprocessingPass.h"
+
+
+namespace sat {
+
+class Formula;
+class Clause;
+class Variable;
+
+namespace preprocessing {
+
+class ReconstructionStack;
+
+
+/**
+ * @brief Bounded variable elimination.
+ *
+ * A variable is eliminated by replacing the clauses where it occurs by all
+ * their non-tautological resolvents on that variable, as long as this does
+ * not increase the number of clauses. The variables are tried by increasing
+ * number of possible resolvents.
+ *
+ * When the clauses of the variable define it as a gate (AND, XOR or
+ * if-then-else) of other variables, only the resolvents between the gate
+ * clauses and the other clauses are needed, which makes more eliminations
+ * possible.
+ *
+ * The removed clauses are recorded in a ReconstructionStack, to give a value
+ * to the eliminated variables once the simplified formula is solved.
+ */
+class VariableEliminator : public PreprocessingPass {
+public:
+	/** The variables occuring in more clauses than this in both polarities are not tried. */
+	static constexpr unsigned int OCCURENCE_LIMIT = 16;
+
+	/** The eliminations that would create a bigger resolvent are not done. */
+	static constexpr unsigned int RESOLVENT_SIZE_LIMIT = 20;
+
+	/** The number of literals that may be visited to build resolvents. */
+	static constexpr unsigned long RESOLUTION_BUDGET = 20000000;
+
+	/**
+	 * Creates an eliminator.
+	 *
+	 * @param p_formula
+	 *            the formula to simplify
+	 * @param p_reconstruction
+	 *            the stack where the removed clauses are recorded
+	 */
+	VariableEliminator(Formula& p_formula, ReconstructionStack& p_reconstruction);
+
+	/**
+	 * Gives the name of the pass: "elimination".
+	 */
+	const char* name() const override;
+
+	/**
+	 * Eliminates the variables.
+	 *
+	 * @return the number of simplifications done
+	 */
+	unsigned int run() override;
+
+	/**
+	 * Eliminates the variables of the formula until no elimination is possible
+	 * or the budget is exhausted.
+	 *
+	 * @return the number of variables eliminated by this call
+	 */
+	unsigned int eliminate();
+
+	/**
+	 * Gives the number of variables eliminated so far.
+	 */
+	unsigned int eliminatedVariables() const;
+
+	/**
+	 * Gives the number of eliminations that used a gate definition.
+	 */
+	unsigned int eliminatedGates() const;
+
+	/**
+	 * Gives the number of clauses removed so far.
+	 */
+	unsigned int removedClauses() const;
+
+	/**
+	 * Gives the number of resolvents added so far.
+	 */
+	unsigned int addedClauses() const;
+
+protected:
+	/**
+	 * Tries to eliminate a variable.
+	 *
+	 * @param p_variable
+	 *            the variable to eliminate
+	 *
+	 * @return true if the variable has been eliminated
+	 */
+	bool eliminate(const std::shared_ptr<Variable>& p_variable);
+
+	/**
+	 * Searches clauses that define the variable as a gate.
+	 * The gate clauses are flagged in p_positiveGate and p_negativeGate.
+	 *
+	 * @return true if a gate has been found
+	 */
+	bool findGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const;
+
+	/**
+	 * Searches an AND gate whose output is the variable with the given sign.
+	 * The clauses of the output are p_outputs, the clauses of its negation are p_inputs.
+	 */
+	bool findAndGate(const std::vector<std::shared_ptr<Clause>>& p_outputs, std::vector<bool>& p_outputGate,
+	                 const std::vector<std::shared_ptr<Clause>>& p_inputs,  std::vector<bool>& p_inputGate) const;
+
+	/**
+	 * Searches a XOR gate between two other variables.
+	 */
+	bool findXorGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const;
+
+	/**
+	 * Searches an if-then-else gate between three other variables.
+	 */
+	bool findIteGate(std::vector<bool>& p_positiveGate, std::vector<bool>& p_negativeGate) const;
+
+	/**
+	 * Computes the resolvent of two clauses on the current variable.
+	 *
+	 * @param p_positive
+	 *            the clause where the variable is positive
+	 * @param p_negative
+	 *            the clause where the variable is negative
+	 * @param p_resolvent
+	 *            receives the literals of the resolvent
+	 *
+	 * @return false if the resolvent is a tautology
+	 */
+	bool resolve(const Clause& p_positive, const Clause& p_negative, std::vector<int>& p_resolvent);
+
+private:
+	/** The variable being eliminated. */
+	Id m_variableId;
+
+	/** The clauses where the current variable is positive. */
+	std::vector<std::shared_ptr<Clause>> m_positives;
+
+	/** The clauses where the current variable is negative. */
+	std::vector<std::shared_ptr<Clause>> m_negatives;
+
+	/** The variables that shared a clause with the last eliminated variable. */
+	std::vector<Id> m_touched;
+
+	/** The number of eliminated variables. */
+	unsigned int m_eliminatedVariables;
+
+	/** The number of eliminations that used a gate. */
+	unsigned int m_eliminatedGates;
+
+	/** The number of removed clauses. */
+	unsigned int m_removedClauses;
+
+	/** The number of added resolvents. */
+	unsigned int m_addedClauses;
+};
+
+} // namespace sat::preprocessing
+} // namespace sat
+
+#endif // VARIABLE_ELIMINATOR_H
@@ -0,0 +1,230 @@
+/*  Copyright 2015 Olivier Serve
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
+ */
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+#include "log.h"
+#include "CnfLoader.h"
+#include "CnfWriter.h"
+#include "FormulaFeatures.h"
+#include "Strategy.h"
+#include "StrategyTable.h"
+#include "Preprocessor.h"
+#include "PreprocessingStatisticsListener.h"
+#include "FailedLiteralProber.h"
+#include "EquivalenceSubstituter.h"
+#include "Subsumer.h"
+#include "BlockedClauseEliminator.h"
+#include "VariableEliminator.h"
+#include "SymmetryBreaker.h"
+
+
+/* Exit codes */
+#define EXIT_SUCCESS           0
+#define EXIT_LOG_FAILURE      -1
+#define EXIT_STRATEGY_FAILURE -2
+#define EXIT_IO_FAILURE       -3
+
+
+/**
+ * Displays the usage message.
+ *
+ * @param p_command
+ *            the command name as given to argv[0]
+ */
+void usage(char* p_command) {
+	std::cout << "Usage: " << p_command << " [-s <strategy_file>] <cnf_file> <simplified_file> <reconstruction_file>" << std::endl;
+	std::cout << "       " << p_command << " -x <reconstruction_file> <sat_file>" << std::endl;
+	std::cout << "    -s <strategy_file>       a table of rules selecting the simplifications from the formula features" << std::endl;
+	std::cout << "    -x <reconstruction_file> lifts a solution of the simplified problem to the original one, printed on the standard output" << std::endl;
+	std::cout << "    <cnf_file>               a CNF problem" << std::endl;
+	std::cout << "    <simplified_file>        the CNF problem to write once simplified" << std::endl;
+	std::cout << "    <reconstruction_file>    the clauses removed by the simplifications" << std::endl;
+	std::cout << "    <sat_file>               a CNF solution of the simplified problem" << std::endl;
+}
+
+
+/**
+ * Simplifies a problem, and writes the result and the removed clauses.
+ *
+ * @param p_cnfFilename
+ *            the problem to simplify
+ * @param p_strategyFilename
+ *            the strategy table, or nullptr for the built-in one
+ * @param p_simplifiedFilename
+ *            the file where the simplified problem is written
+ * @param p_reconstructionFilename
+ *            the file where the removed clauses are written
+ *
+ * @return the exit code
+ */
+int simplify(char* p_cnfFilename, char* p_strategyFilename, char* p_simplifiedFilename, char* p_reconstructionFilename) {
+	// Load the formula
+	sat::Formula formula;
+	sat::CnfLoader loader;
+	if (!loader.loadProblem(p_cnfFilename, formula)) {
+		std::cerr << "Could not load CNF file '" << p_cnfFilename << "', aborting." << std::endl;
+		return EXIT_IO_FAILURE;
+	}
+	formula.log();
+
+	/* Select the strategy from the formula features */
+	sat::solver::selectors::StrategyTable strategies;
+	if (p_strategyFilename != nullptr && !strategies.load(p_strategyFilename)) {
+		std::cerr << "Could not load strategy file '" << p_strategyFilename << "', aborting." << std::endl;
+		return EXIT_STRATEGY_FAILURE;
+	}
+	sat::FormulaFeatures features(formula);
+	auto strategy = strategies.select(features);
+
+	/* Simplify the formula */
+	sat::preprocessing::Preprocessor preprocessor(formula);
+	sat::preprocessing::PreprocessingStatisticsListener preprocessingStats;
+	preprocessor.addListener(preprocessingStats);
+	preprocessor.setEffort(strategy.preprocessingEffort());
+	if (strategy.probing())
+		preprocessor.addPass<sat::preprocessing::FailedLiteralProber>();
+	if (strategy.equivalence())
+		preprocessor.addPass<sat::preprocessing::EquivalenceSubstituter>();
+	if (strategy.subsumption())
+		preprocessor.addPass<sat::preprocessing::Subsumer>();
+	if (strategy.blockedClauseElimination())
+		preprocessor.addPass<sat::preprocessing::BlockedClauseEliminator>();
+	if (strategy.variableElimination())
+		preprocessor.addPass<sat::preprocessing::VariableEliminator>();
+	if (strategy.symmetryBreaking())
+		preprocessor.addPass<sat::preprocessing::SymmetryBreaker>();
+	preprocessor.preprocess();
+
+	/* Write the simplified formula and the removed clauses */
+	sat::CnfWriter writer;
+	if (!writer.writeProblem(p_simplifiedFilename, formula)) {
+		std::cerr << "Could not write simplified file '" << p_simplifiedFilename << "', aborting." << std::endl;
+		return EXIT_IO_FAILURE;
+	}
+	std::ofstream reconstructionFile(p_reconstructionFilename);
+	preprocessor.reconstruction().write(reconstructionFile);
+	reconstructionFile.close();
+	if (reconstructionFile.fail()) {
+		std::cerr << "Could not write reconstruction file '" << p_reconstructionFilename << "', aborting." << std::endl;
+		return EXIT_IO_FAILURE;
+	}
+
+	std::cout << "c Simplification of cnf file " << p_cnfFilename << std::endl;
+	std::cout << "c " << features << std::endl;
+	std::cout << "c " << strategy << std::endl;
+	std::cout << "c " << preprocessingStats << std::endl;
+	std::cout << "c Simplified [ " << formula.countVariables() << " variables  |  " <<
+			formula.countClauses() << " clauses  |  " <<
+			preprocessor.reconstruction().size() << " removed clauses ]" << std::endl;
+	return EXIT_SUCCESS;
+}
+
+
+/**
+ * Lifts a solution of a simplified problem to the original problem.
+ *
+ * @param p_reconstructionFilename
+ *            the file where the removed clauses were written
+ * @param p_satFilename
+ *            the solution of the simplified problem
+ *
+ * @return the exit code
+ */
+int lift(char* p_reconstructionFilename, char* p_satFilename) {
+	std::ifstream reconstructionFile(p_reconstructionFilename);
+	sat::preprocessing::ReconstructionStack reconstruction;
+	if (!reconstructionFile.is_open() || !reconstruction.read(reconstructionFile)) {
+		std::cerr << "Could not read reconstruction file '" << p_reconstructionFilename << "', aborting." << std::endl;
+		return EXIT_IO_FAILURE;
+	}
+
+	sat::CnfLoader loader;
+	auto solution = loader.loadSolution(p_satFilename);
+	if (solution == nullptr) {
+		std::cout << "s UNSATISFIABLE" << std::endl;
+		return EXIT_SUCCESS;
+	}
+
+	reconstruction.extend(*solution);
+	std::cout << "s SATISFIABLE" << std::endl;
+	std::cout << "v";
+	for (const auto& literal : *solution)
+		std::cout << " " << literal.sign() * static_cast<int>(literal.id());
+	std::cout << " 0" << std::endl;
+	return EXIT_SUCCESS;
+}
+
+
+/**
+ * Main function.
+ *
+ * @param p_argc
+ *            the count of arguments in p_argv
+ * @param p_argv
+ *            the array of command-line arguments
+ *
+ * @return -3 if a file cannot be read or written,
+ *         -2 if the strategy file cannot be loaded,
+ *         -1 if the log initialization fails,
+ *          0 otherwise
+ */
+int main(int p_argc, char* p_argv[]) {
+	// Parse the options
+	char* strategyFilename = nullptr;
+	char* reconstructionFilename = nullptr;
+	int option;
+	while ((option = getopt(p_argc, p_argv, "s:x:")) != -1) {
+		switch (option) {
+			case 's':
+				strategyFilename = optarg;
+				break;
+
+			case 'x':
+				reconstructionFilename = optarg;
+				break;
+
+			default:
+				usage(p_argv[0]);
+				exit(EXIT_SUCCESS);
+		}
+	}
+
+	// Wrong number of files: display usage and exit
+	auto files = p_argc - optind;
+	if ((reconstructionFilename == nullptr && files != 3) || (reconstructionFilename != nullptr && files != 1)) {
+		usage(p_argv[0]);
+		exit(EXIT_SUCCESS);
+	}
+
+	// Initialize the logging system
+	if (log_setup()) {
+		std::cerr << "Log initialization failed, aborting." << std::endl;
+		exit(EXIT_LOG_FAILURE);
+	}
+
+	auto rc = reconstructionFilename == nullptr
+			? simplify(p_argv[optind], strategyFilename, p_argv[optind + 1], p_argv[optind + 2])
+			: lift(reconstructionFilename, p_argv[optind]);
+
+	// Clean the logging system
+	if (log_cleanup())
+		std::cerr << "Log cleanup failed." << std::endl;
+
+	return rc;
+}
@@ -14,24 +14,44 @@
  *  along with this program; if not, write to the Free Software
  *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111 USA
  */
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
 
 #include "log.h"
 #include "CnfLoader.h"
+#include "FormulaCache.h"
+#include "FormulaFeatures.h"
+#include "FormulaComponents.h"
+#include "ComponentSolver.h"
 #include "IterativeDpllSolver.h"
+#include "SpecializedDpllSolvers.h"
 #include "Valuation.h"
-#include "VariablePolarityLiteralSelector.h"
-#include "MostUsedVariableSelector.h"
-#include "MostUsedPolaritySelector.h"
-#include "PolarityCachingSelector.h"
+#include "Strategy.h"
+#include "StrategyTable.h"
+#include "StrategySelectors.h"
 #include "StatisticsListener.h"
 #include "ChronoListener.h"
 #include "LoggingListener.h"
+#include "Preprocessor.h"
+#include "PreprocessingStatisticsListener.h"
+#include "FailedLiteralProber.h"
+#include "EquivalenceSubstituter.h"
+#include "Subsumer.h"
+#include "BlockedClauseEliminator.h"
+#include "VariableEliminator.h"
+#include "SymmetryBreaker.h"
 
 
 /* Exit codes */
-#define EXIT_SUCCESS      0
-#define EXIT_LOG_FAILURE -1
+#define EXIT_SUCCESS           0
+#define EXIT_LOG_FAILURE      -1
+#define EXIT_STRATEGY_FAILURE -2
+#define EXIT_IO_FAILURE       -3
 
 
 /**
@@ -41,8 +61,87 @@
  *            the command name as given to argv[0]
  */
 void usage(char* p_command) {
-	std::cout << "Usage: " << p_command << " <cnf_file>" << std::endl;
-	std::cout << "    <cnf_file>  a CNF problem" << std::endl;
+	std::cout << "Usage: " << p_command << " [-s <strategy_file>] [-r <seed>] [-t <threads>] [-n] <cnf_file>" << std::endl;
+	std::cout << "    -s <strategy_file>  a table of rules selecting the heuristics from the formula features" << std::endl;
+	std::cout << "    -r <seed>           the seed of the random decisions, overrides the strategy" << std::endl;
+	std::cout << "    -t <threads>        the number of threads parsing a big file and solving the independent components, one per core by default" << std::endl;
+	std::cout << "    -n                  neither read nor write the binary cache kept next to the CNF file" << std::endl;
+	std::cout << "    <cnf_file>          a CNF problem, or - to read it from the standard input" << std::endl;
+}
+
+
+/**
+ * Tells whether a strategy is one of the specialized configurations.
+ *
+ * @param p_strategy
+ *            the selected strategy
+ * @param p_variableSelector
+ *            the variable selector of the configuration
+ * @param p_polaritySelector
+ *            the polarity selector of the configuration
+ */
+bool isSpecialized(const sat::solver::selectors::Strategy& p_strategy, const char* p_variableSelector, const char* p_polaritySelector) {
+	return p_strategy.variableSelector() == p_variableSelector
+		&& p_strategy.polaritySelector() == p_polaritySelector
+		&& !p_strategy.polarityCaching()
+		&& !p_strategy.isRandomized();
+}
+
+
+/**
+ * Solves a formula with a configuration compiled with its heuristics and listeners.
+ *
+ * @param p_formula
+ *            the formula to solve
+ * @param p_listeners
+ *            the listeners
+ *
+ * @return the valuation found
+ */
+template<class VariableSelectorType, class PolaritySelectorType>
+sat::solver::Valuation solveSpecialized(sat::Formula& p_formula, sat::solver::DefaultListeners& p_listeners) {
+	VariableSelectorType variableSelector;
+	PolaritySelectorType polaritySelector;
+	sat::solver::StaticLiteralSelector<VariableSelectorType, PolaritySelectorType> literalSelector(variableSelector, polaritySelector);
+
+	sat::solver::BasicIterativeDpllSolver<decltype(literalSelector), sat::solver::DefaultListeners> solver(p_formula, literalSelector, p_listeners);
+	return solver.solve();
+}
+
+
+/**
+ * Solves a formula, with a specialized solver if there is one for the strategy.
+ *
+ * @param p_formula
+ *            the formula to solve
+ * @param p_strategy
+ *            the selected strategy
+ * @param p_stats
+ *            the statistics listener
+ * @param p_chrono
+ *            the chronometer listener
+ *
+ * @return the valuation found
+ */
+sat::solver::Valuation solve(sat::Formula& p_formula, const sat::solver::selectors::Strategy& p_strategy, sat::solver::listeners::StatisticsListener& p_stats, sat::solver::listeners::ChronoListener& p_chrono) {
+	if (isSpecialized(p_strategy, "mostused", "mostused")) {
+		sat::solver::DefaultListeners listeners(p_stats, p_chrono);
+		return solveSpecialized<sat::solver::selectors::MostUsedVariableSelector, sat::solver::selectors::MostUsedPolaritySelector>(p_formula, listeners);
+	}
+
+	if (isSpecialized(p_strategy, "leastused", "positive")) {
+		sat::solver::DefaultListeners listeners(p_stats, p_chrono);
+		return solveSpecialized<sat::solver::selectors::LeastUsedVariableSelector, sat::solver::selectors::PositiveFirstPolaritySelector>(p_formula, listeners);
+	}
+
+	sat::solver::selectors::StrategySelectors selectors(p_strategy, p_formula);
+	sat::solver::IterativeDpllSolver solver(p_formula, selectors.literalSelector());
+	selectors.attach(solver);
+	//sat::solver::listeners::LoggingListener logging;
+	//solver.addListener(logging);
+	solver.addListener(p_stats);
+	solver.addListener(p_chrono);
+	return solver.solve();
 }
 
 
@@ -54,12 +153,44 @@ void usage(char* p_command) {
  * @param p_argv
  *            the array of command-line arguments
  * 
- * @return -1 if the log initialization fails,
+ * @return -3 if the CNF file cannot be loaded,
+ *         -2 if the strategy file cannot be loaded or the seed is invalid,
+ *         -1 if the log initialization fails,
  *          0 otherwise
  */
 int main(int p_argc, char* p_argv[]) {
-	// No argument: display usage and exit
-	if (p_argc != 2) {
+	// Parse the options
+	char* strategyFilename = nullptr;
+	char* seed = nullptr;
+	unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+	bool useCache = true;
+	int option;
+	while ((option = getopt(p_argc, p_argv, "s:r:t:n")) != -1) {
+		switch (option) {
+			case 's':
+				strategyFilename = optarg;
+				break;
+
+			case 'r':
+				seed = optarg;
+				break;
+
+			case 't':
+				threads = std::max(std::atoi(optarg), 1);
+				break;
+
+			case 'n':
+				useCache = false;
+				break;
+
+			default:
+				usage(p_argv[0]);
+				exit(EXIT_SUCCESS);
+		}
+	}
+
+	// No file: display usage and exit
+	if (optind != p_argc - 1) {
 		usage(p_argv[0]);
 		exit(EXIT_SUCCESS);
 	}
@@ -72,38 +203,88 @@ int main(int p_argc, char* p_argv[]) {
 	
 	{
 		// File to load
-		auto cnfFilename = p_argv[1];
+		auto cnfFilename = p_argv[optind];
 
 		// Load the formula
 		sat::Formula formula;
-		sat::CnfLoader loader;
-		loader.loadProblem(cnfFilename, formula);
+		sat::FormulaCache cache(cnfFilename);
+		useCache = useCache && std::string(cnfFilename) != "-";
+		if (!useCache || !cache.load(formula)) {
+			sat::CnfLoader loader(threads);
+			if (!loader.loadProblem(cnfFilename, formula)) {
+				std::cerr << "Could not load CNF file '" << cnfFilename << "', aborting." << std::endl;
+				exit(EXIT_IO_FAILURE);
+			}
+			if (useCache && formula.hasClauses())
+				cache.write(formula);
+		}
 		formula.log();
 
-		/* Build the literal selection strategy */
-		sat::solver::selectors::MostUsedVariableSelector variableSelector;
-		sat::solver::selectors::MostUsedPolaritySelector polaritySelector;
-		sat::solver::VariablePolarityLiteralSelector literalSelector(variableSelector, polaritySelector);
-		//sat::solver::selectors::PolarityCachingSelector cachingPolaritySelector(polaritySelector);
-		//sat::solver::VariablePolarityLiteralSelector literalSelector(variableSelector, cachingPolaritySelector);
-		
-		/* Build the solver */
-		sat::solver::IterativeDpllSolver solver(formula, literalSelector);
-
-		/* Build and add the listeners */
-		//sat::solver::listeners::LoggingListener logging;
+		/* Select the strategy from the formula features */
+		sat::solver::selectors::StrategyTable strategies;
+		if (strategyFilename != nullptr && !strategies.load(strategyFilename)) {
+			std::cerr << "Could not load strategy file '" << strategyFilename << "', aborting." << std::endl;
+			exit(EXIT_STRATEGY_FAILURE);
+		}
+		sat::FormulaFeatures features(formula);
+		auto strategy = strategies.select(features);
+		if (seed != nullptr && !strategy.set("seed", seed)) {
+			std::cerr << "Invalid seed '" << seed << "', aborting." << std::endl;
+			exit(EXIT_STRATEGY_FAILURE);
+		}
+
+		/* Simplify the formula, the removed clauses are kept to complete the solution */
+		sat::preprocessing::Preprocessor preprocessor(formula);
+		sat::preprocessing::PreprocessingStatisticsListener preprocessingStats;
+		preprocessor.addListener(preprocessingStats);
+		preprocessor.setEffort(strategy.preprocessingEffort());
+		if (strategy.probing())
+			preprocessor.addPass<sat::preprocessing::FailedLiteralProber>();
+		if (strategy.equivalence())
+			preprocessor.addPass<sat::preprocessing::EquivalenceSubstituter>();
+		if (strategy.subsumption())
+			preprocessor.addPass<sat::preprocessing::Subsumer>();
+		if (strategy.blockedClauseElimination())
+			preprocessor.addPass<sat::preprocessing::BlockedClauseEliminator>();
+		if (strategy.variableElimination())
+			preprocessor.addPass<sat::preprocessing::VariableEliminator>();
+		if (strategy.symmetryBreaking())
+			preprocessor.addPass<sat::preprocessing::SymmetryBreaker>();
+		preprocessor.preprocess();
+
+		/* Build the listeners */
 		sat::solver::listeners::StatisticsListener stats;
 		sat::solver::listeners::ChronoListener chrono;
-		//solver.addListener(logging);
-		solver.addListener(stats);
-		solver.addListener(chrono);
-		//solver.addListener(cachingPolaritySelector);
-		
-		/* Solve the problem */
-		auto valuation = solver.solve();
-		
+
+		/* Solve the problem, the independent components on their own */
+		sat::solver::Valuation valuation;
+		sat::FormulaComponents components(formula);
+		if (strategy.components() && components.count() > 1) {
+			std::mutex statsMutex;
+			auto solveComponent = [&strategy, &stats, &statsMutex](sat::Formula& p_component) {
+				sat::solver::listeners::StatisticsListener componentStats;
+				sat::solver::listeners::ChronoListener componentChrono;
+				auto componentValuation = solve(p_component, strategy, componentStats, componentChrono);
+				std::lock_guard<std::mutex> lock(statsMutex);
+				stats += componentStats;
+				return componentValuation;
+			};
+			sat::solver::ComponentSolver solver(components, solveComponent, threads);
+			chrono.init();
+			valuation = solver.solve();
+			chrono.cleanup();
+		}
+		else
+			valuation = solve(formula, strategy, stats, chrono);
+
+		preprocessor.extend(valuation);
+
 		/* Output the solution */
 		std::cout << "c Solution to cnf file " << cnfFilename << std::endl;
+		std::cout << "c " << features << std::endl;
+		std::cout << "c " << strategy << std::endl;
+		std::cout << "c Components [ " << components.count() << " ]" << std::endl;
+		std::cout << "c " << preprocessingStats << std::endl;
 		std::cout << "c " << stats  << std::endl;
 		std::cout << "c " << chrono << std::endl;
 		std::cout << valuation;
@@ -32,6 +32,8 @@ namespace sudoku {
 // METHODS
 /**
  * Loads a Sudoku problem from a CNF file.
+ * The clauses are created through the builder of the formula, which reuses
+ * its buffer, and the variables are linked to them once they are all created.
  *
  * @param p_filename
  *            the name of the file to load
@@ -42,12 +44,14 @@ void SudokuLoader::loadProblem(char* p_filename, sat::Formula& p_formula) {
 	log_debug(log_sudoku, "Loading sudoku problem from file '%s'...", p_filename);
 	m_clauseId = 1u;
 
+	p_formula.deferOccurences();
 	generateSudokuConstraints(p_formula);
 
 	// Ouverture du fichier
 	std::ifstream file(p_filename);
 	if (!file.is_open()) {
 		log_error(log_sudoku, "Could not open file '%s'.", p_filename);
+		p_formula.linkOccurences();
 		return;
 	}
 	log_debug(log_sudoku, "File '%s' opened.", p_filename);
@@ -60,6 +64,7 @@ void SudokuLoader::loadProblem(char* p_filename, sat::Formula& p_formula) {
 			        .withPositiveLiteral(literal.value())
 			        .build();
 	}
+	p_formula.linkOccurences();
 	log_info(log_sudoku, "Sudoku problem loaded from file '%s'.", p_filename);
 }
 
@@ -146,7 +151,7 @@ void SudokuLoader::generateSquareConstraints(sat::Formula& p_formula, unsigned i
 void SudokuLoader::generateValuesPerCell(sat::Formula& p_formula) {
 	for (auto line=1u; line<=SIZE; line++)
 		for (auto column=1u; column<=SIZE; column++) {
-			auto clause = p_formula.newClause(m_clauseId++);
+			auto& clause = p_formula.newClause(m_clauseId++);
 			for (auto value=1u; value<=SIZE; value++)
 				clause.withPositiveLiteral(line*100 + column*10 + value);
 			clause.build();
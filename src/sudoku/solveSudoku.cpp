@@ -20,14 +20,8 @@
 #include <ranges>
 #include "log.h"
 #include "SudokuLoader.h"
-#include "IterativeDpllSolver.h"
+#include "SpecializedDpllSolvers.h"
 #include "Valuation.h"
-#include "VariablePolarityLiteralSelector.h"
-#include "MostUsedVariableSelector.h"
-#include "MostUsedPolaritySelector.h"
-#include "PolarityCachingSelector.h"
-#include "StatisticsListener.h"
-#include "ChronoListener.h"
 
 
 /* Exit codes */
@@ -123,19 +117,15 @@ int main(int p_argc, char* p_argv[]) {
 		/* Build the literal selection strategy */
 		sat::solver::selectors::MostUsedVariableSelector variableSelector;
 		sat::solver::selectors::MostUsedPolaritySelector polaritySelector;
-		sat::solver::VariablePolarityLiteralSelector literalSelector(variableSelector, polaritySelector);
-		//sat::solver::selectors::PolarityCachingSelector cachingPolaritySelector(polaritySelector);
-		//sat::solver::VariablePolarityLiteralSelector literalSelector(variableSelector, cachingPolaritySelector);
+		sat::solver::MostUsedLiteralSelector literalSelector(variableSelector, polaritySelector);
 
-		/* Build the solver */
-		sat::solver::IterativeDpllSolver solver(formula, literalSelector);
-
-		/* Build and add the listeners */
+		/* Build the listeners */
 		sat::solver::listeners::StatisticsListener stats;
 		sat::solver::listeners::ChronoListener chrono;
-		solver.addListener(stats);
-		solver.addListener(chrono);
-		//solver.addListener(cachingPolaritySelector);
+		sat::solver::DefaultListeners listeners(stats, chrono);
+
+		/* Build the solver, specialized for this configuration */
+		sat::solver::MostUsedDpllSolver solver(formula, literalSelector, listeners);
 
 		/* Solve the problem */
 		auto valuation = solver.solve();